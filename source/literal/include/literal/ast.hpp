@@ -9,6 +9,9 @@
 #include <boost/fusion/adapted/struct.hpp>
 #include <boost/spirit/home/x3/support/ast/variant.hpp>
 #include <boost/optional.hpp>
+
+#include <literal/util/memoized_value.hpp>
+
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -33,7 +36,7 @@ struct real_type : x3::position_tagged {
     std::string exponent;
     // numeric representation
     using value_type = double;
-    std::optional<value_type> value;
+    util::memoized_value<value_type> value;
 };
 
 struct integer_type : x3::position_tagged {
@@ -42,7 +45,7 @@ struct integer_type : x3::position_tagged {
     std::string exponent;  // positive only!
     // numeric representation
     using value_type = std::uint32_t;
-    std::optional<value_type> value;
+    util::memoized_value<value_type> value;
 };
 
 struct based_literal : x3::position_tagged {
@@ -64,7 +67,7 @@ struct bit_string_literal : x3::position_tagged {
     std::string literal;
     // numeric representation
     using value_type = std::uint32_t;
-    std::optional<value_type> value;
+    util::memoized_value<value_type> value;
 };
 
 struct identifier : x3::position_tagged {
@@ -74,6 +77,9 @@ struct identifier : x3::position_tagged {
 struct physical_literal : x3::position_tagged {
     abstract_literal literal;
     std::string unit_name;
+    // normalized count of the primary unit, e.g. fs for TIME
+    using value_type = std::int64_t;
+    util::memoized_value<value_type> value;
 };
 
 using numeric_literal = variant<abstract_literal, physical_literal>;
@@ -91,6 +97,17 @@ struct string_literal : x3::position_tagged {
 using literal = variant<std::monostate, numeric_literal, enumeration_literal, string_literal, bit_string_literal, identifier>;
 using literals = std::vector<literal>;
 
+///
+/// Lazy, memoized access to the numeric value of the literal. The literal is converted on
+/// first access, the result - value or error - is cached by the node. Safe to be called
+/// from concurrent readers.
+///
+/// @throws leaf::exception with the (cached) error code of the conversion.
+///
+real_type::value_type value_of(real_type const& real);
+integer_type::value_type value_of(integer_type const& int_);
+bit_string_literal::value_type value_of(bit_string_literal const& literal);
+
 std::ostream& operator<<(std::ostream& os, ast::real_type const& real);
 std::ostream& operator<<(std::ostream& os, ast::integer_type const& int_);
 std::ostream& operator<<(std::ostream& os, ast::based_literal const& literal);
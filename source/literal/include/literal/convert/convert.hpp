@@ -6,29 +6,31 @@
 #pragma once
 
 #include <literal/ast.hpp>
+#include <literal/convert/packed_bits.hpp>
+#include <literal/convert/detail/chr2dec.hpp>
 #include <literal/convert/detail/safe_math.hpp>
 #include <literal/convert/detail/power.hpp>
 #include <literal/convert/detail/from_chars.hpp>
+#include <literal/convert/detail/based_real.hpp>
+#include <literal/convert/detail/decimal_real.hpp>
 #include <literal/convert/detail/constraint_types.hpp>
 
 #include <boost/leaf.hpp>
 #include <literal/convert/leaf_errors.hpp>
 
 #include <range/v3/view/filter.hpp>
-#include <range/v3/view/join.hpp>
 #include <range/v3/range/conversion.hpp>
 
 #include <fmt/format.h>
 
+#include <bit>
 #include <charconv>
+#include <type_traits>
 #include <system_error>
 
 #include <string>
 #include <string_view>
 #include <cmath>
-#include <numeric>  // accumulate
-
-#include <cfenv>
 
 #include <iostream>
 #include <iomanip>
@@ -55,264 +57,163 @@ static inline std::string remove_underline(auto literal)
 }
 
 ///
-/// char-to-decimal for character range with lookup O(1)
-///
-/// @param chr The character to convert to integer value.
-/// @return std::uint32_t
+/// Decode the digits of a bit string literal into packed bits.
 ///
-/// maps '0-9', 'A-Z' and 'a-z' to their corresponding numeric value and maps all
-/// other characters to 0x7F (7-Bit ASCII 127d 'delete').
+/// Each digit maps directly to its bits (no multiply-accumulate), long runs of hexadecimal
+/// digits are decoded 8 digits at once using SWAR. Delimiter '_' are skipped.
 ///
-/// Concept: @see [Coliru](https://godbolt.org/z/EvEnKqxox)
+/// @param base The base of the literal, must be a power of two in range [2, 32].
+/// @param literal The digits of the bit string literal.
+/// @param alloc The allocator used for the words of the result.
+/// @return packed_bits with a bit length of 'number of digits * log2(base)'.
 ///
-std::uint32_t chr2dec(char chr);
+packed_bits decode_packed_bits(unsigned base, std::string_view literal,
+                               packed_bits::allocator_type const& alloc);
 
 template <IntegralType TargetT>
-static inline auto as_integral_integer(unsigned base, std::string_view literal)
+static constexpr TargetT as_integral_integer(unsigned base, std::string_view literal)
 {
     LEAF_ERROR_TRACE;
 
     // FIXME in the past, got wrong results if e.g. the exponent literal was empty
     assert(!literal.empty() && "Attempt to to convert an empty literal");
 
+    if (std::is_constant_evaluated()) {
+        // LEAF; delimiter '_' are skipped by constant evaluation of from_chars()
+        return from_chars<TargetT>(base, literal);
+    }
+
     auto const clean_literal = convert::detail::remove_underline(literal);
     // LEAF
     return from_chars<TargetT>(base, clean_literal);
 }
 
-#if !defined(__APPLE__)
-// Check that floating-point exceptions are supported and floating-point operations
-// use the variable errno to report errors.
-// @see [MATH_ERRNO, MATH_ERREXCEPT, math_errhandling](
-//  https://en.cppreference.com/w/cpp/numeric/math/math_errhandling)
-// @note This check is disabled on macOS since `math_errhandling` expands to non-constexpr
-// function `__math_errhandling` and therefore cannot be used in a constant expression.
-static bool constexpr has_iec60559_math = []() {
-    return static_cast<bool>(math_errhandling & MATH_ERREXCEPT)  //
-           && static_cast<bool>(math_errhandling & MATH_ERRNO);
-}();
-
-static_assert(has_iec60559_math,
-              "Target must support floating-point exceptions and errno to report errors");
-#endif // !__APPLE__
-
-}  // namespace detail
-
+///
+/// Scale the integer literal's value by it's exponent: `value * base^exp_index`
+///
 template <UnsignedIntegralType IntT>
-struct convert_integer {
-    IntT operator()(ast::integer_type const& integer) const
-    {
-        LEAF_ERROR_TRACE;
-        // std::cout << "convert_integer '" << integer << "'\n";
+constexpr IntT scale_integer(IntT value, unsigned base, IntT exp_index)
+{
+    LEAF_ERROR_TRACE;
 
-        // LEAF from std::from_chars()
-        auto const int_result = detail::as_integral_integer<IntT>(integer.base, integer.integer);
+    // LEAF exponent overflow
+    auto const exp_scale = power<IntT>(base, exp_index);
 
-        if (integer.exponent.empty()) {
-            // nothings more to do
-            return int_result;
-        }
+    // LEAF numeric range overflow
+    return ::util::mul<IntT>(value, exp_scale);
+}
 
-        // LEAFfrom std::from_chars() or exponent overflow
-        auto const exp_scale = integer_exponent(integer.base, integer.exponent);
+///
+/// The value of an integer literal `integer * base^exponent`, where the exponent is
+/// decimal and positive.
+///
+template <UnsignedIntegralType IntT>
+constexpr IntT integer_value(unsigned base, std::string_view integer, std::string_view exponent)
+{
+    LEAF_ERROR_TRACE;
 
-        // LEAF numeric range overflow
-        auto const result = ::util::mul<IntT>(int_result, exp_scale);
+    // LEAF from std::from_chars()
+    auto const int_result = as_integral_integer<IntT>(base, integer);
 
-        return result;
+    if (exponent.empty()) {
+        // nothings more to do
+        return int_result;
     }
 
-private:
-    // integer exponent is unsigned
-    IntT integer_exponent(unsigned base, std::string_view exponent_literal) const
-    {
-        LEAF_ERROR_TRACE;
-
-        // base for the exponent representation is always decimal
-        static auto constexpr base10 = 10U;
+    // base for the exponent representation is always decimal
+    auto constexpr base10 = 10U;
 
-        // LEAF- from_chars() may fail
-        auto const exp_index = detail::as_integral_integer<IntT>(base10, exponent_literal);
+    // LEAF- from_chars() may fail
+    auto const exp_index = as_integral_integer<IntT>(base10, exponent);
 
-        // LEAF
-        auto const exp_scale = detail::power<IntT>(base, exp_index);
-
-        return exp_scale;
-    }
-};
-
-template <typename TargetT>
-static convert_integer<TargetT> const integer = {};
+    // LEAF exponent or numeric range overflow
+    return scale_integer<IntT>(int_result, base, exp_index);
+}
 
+///
+/// The correctly rounded value of a real literal `integer.fractional * base^exponent`.
+///
 template <RealType RealT>
-struct convert_real {
-    // concept https://coliru.stacked-crooked.com/a/39b9d958b47f246b
-    RealT operator()(ast::real_type const& real) const
-    {
-        LEAF_ERROR_TRACE;
-
-        // std::cout << "convert_real '" << real << "'\n";
-
-        // This intermediate type is required for converting parts of the real literal to
-        // their integer counterparts.
-        // -------------------------------------------------------------------------------
-        // FixMe: make the concrete type depend on same IntegralType used for integer part. The
-        // intent is to use the full sized table of this type; e.g. by use of 32-bit we wouldn't use
-        // all possible lookup values as this type would be of 64-bit.
-        // -------------------------------------------------------------------------------
-        using promote_integer_type = std::uint32_t;
-
-        if (real.base == 10U) {
-            // std::from_chars() directly supports base 10 floating-point/real types
-            auto const with_exponent = !real.exponent.empty();
-            auto const real_string = as_real_string(real, with_exponent);
-            // LEAF
-            auto const real_result = detail::from_chars<RealT>(real.base, real_string);
-
-            return real_result;
-        }
-
-        if (real.base == 16U) {
-            // std::from_chars() directly supports base 16 floating-point/real types; but the
-            // exponent support is of base 2, so use it without and multiply with the exponent
-            // of base 16 later on (if necessary).
-            // concept [Coliru](https://coliru.stacked-crooked.com/a/596e7723bb7dc531)
-            auto const with_exponent = false;
-            auto const real_string = as_real_string(real, with_exponent);
-            // LEAF
-            auto const real_result = detail::from_chars<RealT>(real.base, real_string);
-
-            if (real.exponent.empty()) {
-                // nothings more to do
-                return real_result;
-            }
-
-            // LEAF
-            auto const exp_scale = real_exponent<promote_integer_type>(real.base, real.exponent);
-
-            // LEAF
-            auto const result = ::util::mul<RealT>(real_result, exp_scale);
-
-            return result;
-        }
-
-        // other bases follow, which aren't directly supported by `from_chars()`
-
-        // LEAF
-        auto const int_result =
-            detail::as_integral_integer<promote_integer_type>(real.base, real.integer);
-
-        auto const frac_result = real_fractional(real.base, real.fractional);
-
-        // LEAF
-        auto const real_result = ::util::add<RealT>(int_result, frac_result);
+constexpr RealT real_value(unsigned base, std::string_view integer, std::string_view fractional,
+                           std::string_view exponent)
+{
+    LEAF_ERROR_TRACE;
 
-        if (real.exponent.empty()) {
-            // nothings more to do
-            return real_result;
-        }
+    if (base < 2U || 36U < base) {
+        // e.g. the default constructed real of a standalone unit name
+        throw leaf::exception(std::make_error_code(std::errc::invalid_argument),
+                              leaf::e_api_function{ "real_value<RealT>" });
+    }
 
+    if (base == 10U) {
+        // decimal reals are parsed natively on the literal's character range, which is
+        // correctly rounded, locale independent and doesn't depend on the availability
+        // of `std::from_chars()` for real types.
         // LEAF
-        auto const exp_scale = real_exponent<promote_integer_type>(real.base, real.exponent);
+        return decimal_real<RealT>(integer, fractional, exponent);
+    }
 
+    if (std::has_single_bit(base)) {
+        // bases 2, 4, 8, 16 and 32: the digits map directly to bits of the mantissa,
+        // the exponent to the base is an exponent of 2. The result is exact, or rounded
+        // once.
         // LEAF
-        auto const result = ::util::mul<RealT>(real_result, exp_scale);
-
-        return result;
+        return pow2_based_real<RealT>(base, integer, fractional, exponent);
     }
 
-private:
-    // Join all parsed elements and prune delimiter '_' to prepare for call of
-    // `from_chars()`. The result is a C++ standard conformance floating point string.
-    // Concept: @see [godbolt.org](https://godbolt.org/z/KroM7oxc5)
-    // @note To return a string prevents stack-use-after-scope, see
-    // ([godbolt](https://godbolt.org/z/vr39h7Y8d))
-    std::string as_real_string(ast::real_type const& real, bool with_exponent) const
-    {
-        using namespace std::literals::string_view_literals;
-
-        auto const remove_underline = [](auto const& literal_list) {
-            namespace views = ranges::views;
-            return ranges::to<std::string>(literal_list | views::join |
-                                           views::filter(detail::underline_predicate));
-        };
+    // other bases follow; all digits are accumulated and scaled exactly, the result is
+    // rounded only once.
 
-        auto const as_sv = [](std::string const& str) { return std::string_view(str); };
+    // LEAF
+    return based_real<RealT>(base, integer, fractional, exponent);
+}
 
-        if (with_exponent) {
-            // clang-format off
-            auto const literal_list = {
-                as_sv(real.integer), "."sv, as_sv(real.fractional), "e"sv, as_sv(real.exponent)
-            };
-            // clang-format on
+///
+/// The value of a bit string literal's digits. The empty bit string literal is allowed, its
+/// value is zero.
+///
+template <UnsignedIntegralType IntT>
+constexpr IntT bit_string_value(unsigned base, std::string_view literal)
+{
+    LEAF_ERROR_TRACE;
 
-            return remove_underline(literal_list);
-        }
+    if (literal.empty()) {
+        return 0;
+    }
 
-        // clang-format off
-        auto const literal_list = {
-            as_sv(real.integer), "."sv, as_sv(real.fractional)
-        };
-        // clang-format on
+    // LEAF
+    return as_integral_integer<IntT>(base, literal);
+}
 
-        return remove_underline(literal_list);
-    }
+}  // namespace detail
 
-    // TODO: replace naive implementation of fractional part calculation
-    // TODO: The summand can get small, consider to use [Kahan Summation](
-    // https://stackoverflow.com/questions/10330002/sum-of-small-double-numbers-c)
-    RealT real_fractional(unsigned base, std::string_view fractional_literal) const
+template <UnsignedIntegralType IntT>
+struct convert_integer {
+    constexpr IntT operator()(ast::integer_type const& integer) const
     {
         LEAF_ERROR_TRACE;
+        // std::cout << "convert_integer '" << integer << "'\n";
 
-        // paranoia, but a base of 0 would result into division by zero by the algorithm used
-        assert(base > 0);
-
-        auto const fractional_string = detail::remove_underline(fractional_literal);
-
-        RealT pow = static_cast<RealT>(base);
-
-        std::feclearexcept(FE_ALL_EXCEPT);
-
-        auto const result =
-            std::accumulate(std::begin(fractional_string), std::end(fractional_string), RealT{ 0 },
-                            [&pow, base](RealT acc, char chr) {
-                                auto dig = static_cast<RealT>(detail::chr2dec(chr));
-                                dig /= pow;
-                                pow *= static_cast<RealT>(base);
-                                return acc + dig;
-                            });
-
-        int const fp_exception_raised = std::fetestexcept(FE_ALL_EXCEPT & ~FE_INEXACT);
-
-        if (fp_exception_raised) {
-            std::feclearexcept(FE_ALL_EXCEPT);
-            auto const ec = std::error_code(errno, std::generic_category());
-            throw leaf::exception(ec, leaf::e_api_function{ "safe_add<RealT>" },
-                                  leaf::e_fp_exception{ fp_exception_raised });
-        }
-
-        return result;
+        // LEAF from std::from_chars(), exponent or numeric range overflow
+        return detail::integer_value<IntT>(integer.base, integer.integer, integer.exponent);
     }
+};
+
+template <typename TargetT>
+static convert_integer<TargetT> const integer = {};
 
-    template <IntegralType IntT>
-    RealT real_exponent(unsigned base, std::string_view exponent_literal) const
+template <RealType RealT>
+struct convert_real {
+    // concept https://coliru.stacked-crooked.com/a/39b9d958b47f246b
+    constexpr RealT operator()(ast::real_type const& real) const
     {
         LEAF_ERROR_TRACE;
 
-        // exponent is signed
-        using signed_type = std::make_signed_t<IntT>;
-
-        // base for the exponent representation is always decimal
-        static auto constexpr base10 = 10U;
-
-        // LEAF from std::from_chars()
-        auto const exp_index = detail::as_integral_integer<signed_type>(base10, exponent_literal);
+        // std::cout << "convert_real '" << real << "'\n";
 
         // LEAF
-        auto const exp_scale = detail::power<RealT>(base, exp_index);
-
-        return exp_scale;
+        return detail::real_value<RealT>(real.base, real.integer, real.fractional,
+                                         real.exponent);
     }
 };
 
@@ -321,19 +222,33 @@ static convert_real<TargetT> const real = {};
 
 template <UnsignedIntegralType TargetT>
 struct convert_bit_string_literal {
-    TargetT operator()(ast::bit_string_literal const& literal) const
+    constexpr TargetT operator()(ast::bit_string_literal const& literal) const
     {
         LEAF_ERROR_TRACE;
 
-        auto const digit_string = detail::remove_underline(literal.literal);
         // LEAF
-        auto const binary_number = detail::from_chars<TargetT>(literal.base, digit_string);
-
-        return binary_number;
+        return detail::bit_string_value<TargetT>(literal.base, literal.literal);
     }
 };
 
 template <typename TargetT>
 static convert_bit_string_literal<TargetT> const bit_string_literal = {};
 
+///
+/// Convert a bit string literal of arbitrary width, e.g. ROM contents or crypto keys,
+/// which doesn't fit into `ast::bit_string_literal::value_type`.
+///
+struct convert_packed_bit_string_literal {
+    packed_bits operator()(ast::bit_string_literal const& literal,
+                           packed_bits::allocator_type const& alloc = {}) const
+    {
+        LEAF_ERROR_TRACE;
+
+        // LEAF
+        return detail::decode_packed_bits(literal.base, literal.literal, alloc);
+    }
+};
+
+static convert_packed_bit_string_literal const packed_bit_string_literal = {};
+
 }  // namespace convert
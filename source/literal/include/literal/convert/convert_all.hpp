@@ -0,0 +1,59 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <literal/ast.hpp>
+#include <literal/convert/physical_unit.hpp>
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace convert {
+
+///
+/// A literal, which can't be converted by @ref convert_all.
+///
+struct conversion_failure {
+    /// index of the literal in the literal list
+    std::size_t index;
+    std::error_code ec;
+    /// human readable error message
+    std::string message;
+};
+
+std::ostream& operator<<(std::ostream& os, conversion_failure const& failure);
+
+enum class convert_mode {
+    sequential,
+    /// worth it for large literal lists only, small lists are converted sequentially
+    parallel
+};
+
+///
+/// Convert all numeric literals of the list, and fill their `value` field. This
+/// separates conversion from parsing, which doesn't need to convert anything in the
+/// middle of the grammar's backtracking (@see USE_IN_PARSER_CONVERT).
+///
+/// The tree is walked once, the work is grouped by kind of literal and base to keep the
+/// conversion's branches predictable. Literals which fail to convert are left without
+/// value, the failure is reported by the returned list instead of throwing.
+///
+/// Physical literals are normalized into the count of their primary unit, @see
+/// convert_physical_literal.
+///
+/// @param literals The list of literals to convert.
+/// @param mode Convert sequentially or in parallel.
+/// @param units The units of physical literals.
+/// @return The failures ordered by literal index, empty if all went fine.
+///
+std::vector<conversion_failure> convert_all(ast::literals& literals,
+                                            convert_mode mode = convert_mode::sequential,
+                                            unit_table const& units = {});
+
+}  // namespace convert
@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <literal/convert/detail/binary_float.hpp>
+#include <literal/convert/detail/chr2dec.hpp>
+#include <literal/convert/detail/constraint_types.hpp>
+#include <literal/convert/leaf_errors.hpp>
+
+#include <boost/leaf/exception.hpp>
+#include <boost/leaf/common.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+namespace convert::detail {
+
+///
+/// Parse the decimal, signed exponent of a real literal, delimiter '_' are skipped.
+///
+/// The result saturates at +/- 2^40, which is far beyond any representable value of
+/// all real types supported.
+///
+/// @throws leaf::exception with `std::errc::invalid_argument` on wrong characters.
+///
+constexpr std::int64_t real_exponent_value(std::string_view exponent)
+{
+    /// Saturation of the decimal exponent value
+    std::int64_t constexpr exponent_saturation = std::int64_t{ 1 } << 40;
+
+    bool negative = false;
+
+    if (!exponent.empty() && (exponent.front() == '+' || exponent.front() == '-')) {
+        negative = exponent.front() == '-';
+        exponent.remove_prefix(1);
+    }
+
+    std::int64_t value = 0;
+
+    for (char const& chr : exponent) {
+        if (chr == '_') {
+            continue;
+        }
+        auto const digit = chr2dec(chr);
+        if (!(digit < 10)) {
+            throw leaf::exception(std::make_error_code(std::errc::invalid_argument),
+                                  leaf::e_api_function{ "real_exponent_value" },
+                                  leaf::e_position_iterator{ &chr });
+        }
+        value = std::min<std::int64_t>(value * 10 + digit, exponent_saturation);
+    }
+
+    return negative ? -value : value;
+}
+
+///
+/// Exact conversion of a real literal of arbitrary base in range [2, 36] into a binary
+/// mantissa.
+///
+/// All digits of the integer and fractional part are accumulated exactly into a big
+/// integer, which is scaled by `base^exponent` exactly. The resulting binary mantissa
+/// carries 64 significant bits and a sticky bit, hence rounding to the real type happens
+/// only once, see @ref to_real.
+///
+/// @param base The base of the literal.
+/// @param integer The integer part digits, may contain delimiter '_'.
+/// @param fractional The fractional part digits, may contain delimiter '_'.
+/// @param exponent The optional, decimal exponent (to the base).
+/// @throws leaf::exception with `std::errc::invalid_argument` on wrong digits.
+///
+binary_mantissa based_real_mantissa(unsigned base, std::string_view integer,
+                                    std::string_view fractional, std::string_view exponent);
+
+///
+/// The binary mantissa of the power `base^exponent` for base in range [2, 36], computed
+/// exactly.
+///
+binary_mantissa power_mantissa(unsigned base, std::int64_t exponent);
+
+///
+/// Exact conversion of a real literal of a power of two base (2, 4, 8, 16 and 32) into a
+/// binary mantissa.
+///
+/// Each digit maps directly to its bits, which are packed into the mantissa. The literal's
+/// exponent is turned into binary exponent arithmetic, so there are no multiplications at
+/// all. Digits beyond the mantissa's 64 bits go into the sticky bit.
+///
+/// @param base The base of the literal, must be a power of two in range [2, 32].
+/// @param integer The integer part digits, may contain delimiter '_'.
+/// @param fractional The fractional part digits, may contain delimiter '_'.
+/// @param exponent The optional, decimal exponent (to the base).
+/// @throws leaf::exception with `std::errc::invalid_argument` on wrong digits.
+///
+binary_mantissa pow2_real_mantissa(unsigned base, std::string_view integer,
+                                   std::string_view fractional, std::string_view exponent);
+
+///
+/// Correctly rounded conversion of a real literal of arbitrary base in range [2, 36].
+///
+template <RealType RealT>
+RealT based_real(unsigned base, std::string_view integer, std::string_view fractional,
+                 std::string_view exponent)
+{
+    LEAF_ERROR_TRACE;
+
+    // LEAF
+    auto const mantissa = based_real_mantissa(base, integer, fractional, exponent);
+
+    // LEAF
+    return to_real<RealT>(mantissa, "based_real<RealT>");
+}
+
+///
+/// Correctly rounded conversion of a real literal of a power of two base.
+///
+template <RealType RealT>
+RealT pow2_based_real(unsigned base, std::string_view integer, std::string_view fractional,
+                      std::string_view exponent)
+{
+    LEAF_ERROR_TRACE;
+
+    // LEAF
+    auto const mantissa = pow2_real_mantissa(base, integer, fractional, exponent);
+
+    // LEAF
+    return to_real<RealT>(mantissa, "pow2_based_real<RealT>");
+}
+
+}  // namespace convert::detail
@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <literal/convert/detail/constraint_types.hpp>
+#include <literal/convert/leaf_errors.hpp>
+
+#include <boost/leaf/exception.hpp>
+#include <boost/leaf/common.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>  // ldexp
+#include <cstdint>
+#include <limits>
+#include <system_error>
+
+namespace convert {
+
+namespace leaf = boost::leaf;
+
+namespace detail {
+
+///
+/// Intermediate binary representation of a real value, before rounding to the target
+/// type: `value = mantissa * 2^exponent`. The sticky flag tells, that there are further
+/// non-zero bits below the mantissa's LSB (the value is inexact).
+///
+/// @note If sticky is set, the mantissa must be normalized, i.e. it's MSB is set. This
+/// way there are always enough guard bits for rounding. An exact mantissa may have any
+/// count of significant bits.
+///
+struct binary_mantissa {
+    std::uint64_t value = 0;
+    std::int64_t exponent = 0;
+    bool sticky = false;
+};
+
+///
+/// Round the binary mantissa once, to nearest with ties to even, to the real type.
+///
+/// Overflow and underflow (the rounded result is zero while the value isn't) are
+/// reported as `std::errc::result_out_of_range`, like `std::from_chars()` does. Subnormal
+/// results are fine. No floating-point environment is involved, `ldexp()` is exact here.
+///
+template <RealType RealT>
+RealT to_real(binary_mantissa const& mantissa, char const* api_name)
+{
+    LEAF_ERROR_TRACE;
+
+    using limits = std::numeric_limits<RealT>;
+
+    // The mantissa holds 64 bits, at least 2 of them are required as guard bits.
+    static_assert(limits::digits <= 62, "real type precision exceeds the 64-bit mantissa");
+
+    static constexpr std::int64_t precision = limits::digits;
+    // exponent of the MSB of the smallest normal and the largest finite number
+    static constexpr std::int64_t min_exponent = limits::min_exponent - 1;
+    static constexpr std::int64_t max_exponent = limits::max_exponent - 1;
+
+    auto const out_of_range = [&] {
+        auto const ec = std::make_error_code(std::errc::result_out_of_range);
+        return leaf::exception(ec, leaf::e_api_function{ api_name });
+    };
+
+    // std::bit_width() returns int with C++23, but the argument type with C++20
+    auto const bit_width = [](std::uint64_t value) {
+        return static_cast<std::int64_t>(std::bit_width(value));
+    };
+
+    if (mantissa.value == 0) {
+        return RealT{ 0 };
+    }
+
+    auto const msb_exponent = mantissa.exponent + bit_width(mantissa.value) - 1;
+
+    // exponent of the LSB to be kept, subnormal numbers have reduced precision
+    auto lsb_exponent = std::max(msb_exponent - precision + 1, min_exponent - precision + 1);
+    auto const shift = lsb_exponent - mantissa.exponent;
+
+    std::uint64_t kept = mantissa.value;
+
+    if (shift > 0) {
+        static constexpr std::int64_t word_bits = 64;
+
+        bool half = false;
+        bool rest = mantissa.sticky;
+
+        if (shift > word_bits) {
+            kept = 0;
+            rest = true;
+        }
+        else {
+            auto const below = static_cast<unsigned>(shift - 1);
+            half = ((mantissa.value >> below) & 1U) != 0;
+            rest = rest || (mantissa.value & ((std::uint64_t{ 1 } << below) - 1)) != 0;
+            kept = (shift == word_bits) ? 0 : mantissa.value >> shift;
+        }
+
+        if (half && (rest || (kept & 1U) != 0)) {
+            ++kept;
+            if (bit_width(kept) > precision) {
+                // carry into a new bit position
+                kept >>= 1;
+                ++lsb_exponent;
+            }
+        }
+    }
+    else {
+        // exact, fewer significant bits than the precision; align to the kept LSB
+        kept <<= static_cast<unsigned>(-shift);
+    }
+
+    if (kept == 0) {
+        // underflow
+        throw out_of_range();
+    }
+
+    if (lsb_exponent + bit_width(kept) - 1 > max_exponent) {
+        // overflow
+        throw out_of_range();
+    }
+
+    return std::ldexp(static_cast<RealT>(kept), static_cast<int>(lsb_exponent));
+}
+
+}  // namespace detail
+}  // namespace convert
@@ -0,0 +1,53 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <array>
+#include <climits>  // CHAR_BIT
+#include <cstddef>
+#include <cstdint>
+
+namespace convert {
+
+namespace detail {
+
+static constexpr auto alnum_to_value_table = []() {
+    unsigned char constexpr lower_letters[] = "abcdefghijklmnopqrstuvwxyz";
+    unsigned char constexpr upper_letters[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    unsigned constexpr N = 1U << CHAR_BIT;
+    std::array<unsigned char, N> table{};  // works with any char type
+
+    for (auto& value : table) {
+        value = 0x7F;
+    }
+    for (std::size_t i = 0; i != 10; ++i) {
+        table['0' + i] = static_cast<unsigned char>(i);
+    }
+    for (std::size_t i = 0; i != 26; ++i) {
+        table[lower_letters[i]] = 10 + static_cast<unsigned char>(i);
+        table[upper_letters[i]] = 10 + static_cast<unsigned char>(i);
+    }
+    return table;
+}();
+
+///
+/// char-to-decimal for character range with lookup O(1)
+///
+/// @param chr The character to convert to integer value.
+/// @return std::uint32_t
+///
+/// maps '0-9', 'A-Z' and 'a-z' to their corresponding numeric value and maps all
+/// other characters to 0x7F (7-Bit ASCII 127d 'delete').
+///
+/// Concept: @see [Coliru](https://godbolt.org/z/EvEnKqxox)
+///
+constexpr std::uint32_t chr2dec(char chr)
+{
+    return alnum_to_value_table[static_cast<unsigned char>(chr)];
+}
+
+}  // namespace detail
+}  // namespace convert
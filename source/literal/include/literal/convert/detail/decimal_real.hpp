@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <literal/convert/detail/based_real.hpp>
+#include <literal/convert/detail/chr2dec.hpp>
+#include <literal/convert/detail/power.hpp>
+#include <literal/convert/detail/constraint_types.hpp>
+#include <literal/convert/leaf_errors.hpp>
+
+#include <boost/leaf/exception.hpp>
+#include <boost/leaf/common.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <system_error>
+
+namespace convert::detail {
+
+///
+/// The leading, significant decimal digits of a real literal, as far as they fit into
+/// 64 bit: `value = digits * 10^scale`.
+///
+struct decimal_significand {
+    std::uint64_t digits = 0;
+    std::int64_t scale = 0;
+    /// non-zero digits are dropped, the value is inexact
+    bool truncated = false;
+};
+
+///
+/// Scan the decimal real literal's parts on the original character range, without any
+/// copy. Delimiter '_' are skipped. The result is independent from the locale.
+///
+/// @throws leaf::exception with `std::errc::invalid_argument` on wrong digits.
+///
+constexpr decimal_significand scan_decimal_real(std::string_view integer,
+                                                std::string_view fractional,
+                                                std::string_view exponent)
+{
+    // 10^19 < 2^64
+    constexpr unsigned max_digits = 19;
+
+    decimal_significand result;
+    unsigned digit_count = 0;
+
+    auto const scan = [&](std::string_view digits, bool is_fractional) {
+        for (char const& chr : digits) {
+            if (chr == '_') {
+                continue;
+            }
+            auto const digit = chr2dec(chr);
+            if (!(digit < 10)) {
+                throw leaf::exception(std::make_error_code(std::errc::invalid_argument),
+                                      leaf::e_api_function{ "scan_decimal_real" },
+                                      leaf::e_position_iterator{ &chr });
+            }
+            if (digit_count == 0 && digit == 0) {
+                // leading zero isn't significant
+                result.scale -= is_fractional ? 1 : 0;
+                continue;
+            }
+            if (digit_count < max_digits) {
+                result.digits = result.digits * 10 + digit;
+                result.scale -= is_fractional ? 1 : 0;
+                ++digit_count;
+                continue;
+            }
+            // dropped digit
+            result.truncated = result.truncated || digit != 0;
+            result.scale += is_fractional ? 0 : 1;
+        }
+    };
+
+    scan(integer, false);
+    scan(fractional, true);
+
+    // LEAF
+    result.scale += real_exponent_value(exponent);
+
+    return result;
+}
+
+///
+/// Correctly rounded conversion of a decimal real literal.
+///
+/// Most of the real literals written by humans have only a few significant digits and a
+/// small exponent. Both, the digits and the power of 10 are exactly representable in
+/// this case, so that a single IEEE multiplication or division gives the correctly
+/// rounded result (Clinger's fast path). All other literals are converted by the exact
+/// engine of @ref based_real.
+///
+/// @note The fast path assumes the default rounding mode, round to nearest. It's usable in
+/// constant evaluation, the exact engine isn't.
+///
+template <RealType RealT>
+constexpr RealT decimal_real(std::string_view integer, std::string_view fractional,
+                   std::string_view exponent)
+{
+    LEAF_ERROR_TRACE;
+
+    constexpr auto base10 = 10U;
+    constexpr auto const& lut = real_power_lut<RealT>;
+    constexpr std::uint64_t max_exact_digits =
+        std::uint64_t{ 1 } << std::min(std::numeric_limits<RealT>::digits, 63);
+
+    // LEAF
+    auto const significand = scan_decimal_real(integer, fractional, exponent);
+
+    if (significand.digits == 0) {
+        return RealT{ 0 };
+    }
+
+    if (!significand.truncated && significand.digits <= max_exact_digits) {
+        auto const exp_ = static_cast<std::uint64_t>(
+            (significand.scale < 0) ? -significand.scale : significand.scale);
+        if (exp_ < lut.max_index(base10)) {
+            auto const value = static_cast<RealT>(significand.digits);
+            auto const scale = lut(base10, static_cast<unsigned>(exp_));
+            return (significand.scale < 0) ? value / scale : value * scale;
+        }
+    }
+
+    // LEAF
+    return based_real<RealT>(base10, integer, fractional, exponent);
+}
+
+}  // namespace convert::detail
@@ -5,7 +5,7 @@
 
 #pragma once
 
-#include <literal/config.hpp>
+#include <literal/convert/detail/chr2dec.hpp>
 #include <literal/convert/detail/constraint_types.hpp>
 #include <literal/convert/numeric_failure.hpp>
 #include <literal/convert/leaf_errors.hpp>
@@ -14,9 +14,11 @@
 #include <boost/leaf/common.hpp>
 
 #include <charconv>
+#include <limits>
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <type_traits>
 
 #include <iostream>
 
@@ -28,7 +30,7 @@ template <typename T>
 struct std_from_chars {
     static auto call([[maybe_unused]] const char* const, [[maybe_unused]] const char* const, [[maybe_unused]] T&, [[maybe_unused]] int)
     {
-        static_assert(nostd::always_false<T>, "must be of unsigned integral or float type");
+        static_assert(nostd::always_false<T>, "must be of integral type");
     }
 };
 
@@ -40,37 +42,48 @@ struct std_from_chars<IntT> {
     }
 };
 
-// Users of libc++ (like on macOS using Clang) doesn't have an implementation of `from_chars()` for
-// float, double, ... real types.
-#if !defined(CONVERT_FROM_CHARS_USE_STRTOD)
-
-template <RealType RealT>
-struct std_from_chars<RealT> {
-    static auto call(const char* const first, const char* const last, RealT& value, unsigned base) noexcept
-    {
-        switch (base) {
-            case 10:
-                return std::from_chars(first, last, value, std::chars_format::general);
-            case 16:
-                // This floating-point literal must not have an exponent as in C++ the exponent
-                // is of base 2, see [Floating-point literal](
-                //  https://en.cppreference.com/w/cpp/language/floating_literal)
-                return std::from_chars(first, last, value, std::chars_format::hex);
-            default:
-                return std::from_chars_result{ first, std::errc::not_supported };
+///
+/// Counterpart of `std::from_chars()` for unsigned integers, which is usable in constant
+/// evaluation. Different from `std::from_chars()`, delimiter '_' are skipped.
+///
+template <UnsignedIntegralType IntT>
+constexpr std::from_chars_result constexpr_from_chars(const char* first, const char* const last,
+                                                      IntT& value, unsigned base) noexcept
+{
+    IntT constexpr max = std::numeric_limits<IntT>::max();
+
+    IntT result = 0;
+    bool has_digits = false;
+
+    for (; first != last; ++first) {
+        if (*first == '_') {
+            continue;
+        }
+        auto const digit = chr2dec(*first);
+        if (!(digit < base)) {
+            break;
         }
-        // never goes here, but makes compiler quiet
-        return std::from_chars_result{ first, std::errc::not_supported };
+        if (result > (max - digit) / base) {
+            return { first, std::errc::result_out_of_range };
+        }
+        result = static_cast<IntT>(result * base + digit);
+        has_digits = true;
     }
-};
 
-#endif
+    if (!has_digits) {
+        return { first, std::errc::invalid_argument };
+    }
+
+    value = result;
+    return { first, std::errc{} };
+}
 
 template <typename TargetT>
 class from_chars_api {
 public:
     // low level API, call `std::from_chars()`, literal must be pruned from delimiter '_'
-    TargetT operator()(unsigned base, std::string_view literal) const
+    // (except on constant evaluation)
+    constexpr TargetT operator()(unsigned base, std::string_view literal) const
     {
         LEAF_ERROR_TRACE;
 
@@ -78,13 +91,16 @@ public:
 
         char const* const end = literal.data() + literal.size();
 
-        TargetT result;
-        auto const [ptr, errc] = std_from_chars<TargetT>::call(literal.data(), end, result, base);
-        // even if errc empty, as error is considered ptr != end - delegate this checks
-        auto const ec = get_error_code(ptr, end, errc);
+        TargetT result{};
+        auto const [ptr, errc] =
+            std::is_constant_evaluated()
+                ? constexpr_from_chars(literal.data(), end, result, base)
+                : std_from_chars<TargetT>::call(literal.data(), end, result, base);
 
-        if (ec) {
-            throw leaf::exception(ec, leaf::e_api_function{ "from_chars" },
+        // even if errc empty, as error is considered ptr != end - delegate this checks
+        if (ptr != end || errc != std::errc{}) {
+            throw leaf::exception(get_error_code(ptr, end, errc),
+                                  leaf::e_api_function{ "from_chars" },
                                   leaf::e_position_iterator{ ptr });
         }
 
@@ -96,7 +112,7 @@ private:
     // [std::from_chars](https://en.cppreference.com/w/cpp/utility/from_chars):
     // "the plus sign is not recognized outside of the exponent" - for VHDL's integer exponent
     // it is allowed, and hence a valid rule for outer parser!
-    static std::string_view remove_positive_sign(std::string_view literal)
+    static constexpr std::string_view remove_positive_sign(std::string_view literal)
     {
         if (!literal.empty() && literal.front() == '+') {
             literal.remove_prefix(1);
@@ -131,7 +147,3 @@ static from_chars_api<TargetT> const from_chars = {};
 }  // namespace detail
 
 }  // namespace convert
-
-#if defined(CONVERT_FROM_CHARS_USE_STRTOD)
-#include <literal/convert/detail/from_chars_real.hpp>
-#endif
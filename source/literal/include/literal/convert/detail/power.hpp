@@ -5,16 +5,21 @@
 
 #pragma once
 
-#include <literal/convert/detail/digit_traits.hpp>
+#include <literal/convert/detail/based_real.hpp>
+#include <literal/convert/detail/binary_float.hpp>
 #include <literal/convert/detail/constraint_types.hpp>
 
 #include <boost/leaf/exception.hpp>
 #include <boost/leaf/common.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <limits>
-#include <cmath>
 
 #include <iostream>
 #include <iomanip>
@@ -28,39 +33,136 @@ namespace detail {
 // concept, see [Coliru](https://coliru.stacked-crooked.com/a/09a6475cf60dd1e9)
 // concept, part #2: https://coliru.stacked-crooked.com/a/47b7cc5e62eb7431
 // concept, part #3: https://godbolt.org/z/oKTP5ajWb
-template <UnsignedIntegralType IntT, unsigned Base>
-requires BasicBaseRange<Base>
-class power_table {
+
+///
+/// Number of powers `base^index`, which are representable by the integer type, the
+/// exponent index is in range [0, count).
+///
+template <UnsignedIntegralType IntT>
+constexpr unsigned power_count(unsigned base)
+{
+    IntT constexpr max = std::numeric_limits<IntT>::max();
+
+    unsigned count = 1;
+    for (IntT value = 1; value <= max / base; value *= base) {
+        ++count;
+    }
+    return count;
+}
+
+///
+/// Number of powers `base^index`, which are exactly representable by the real type, the
+/// exponent index is in range [0, count). This is the case as long as the odd part of
+/// the power fits into the mantissa.
+///
+/// @note Power of two bases are exact over the whole exponent range, they aren't subject
+/// of a lookup table.
+///
+template <RealType RealT>
+constexpr unsigned exact_power_count(unsigned base)
+{
+    // the table is computed using 64-bit integers
+    auto constexpr digits = std::min(std::numeric_limits<RealT>::digits, 63);
+    std::uint64_t constexpr limit = std::uint64_t{ 1 } << digits;
+
+    auto const odd = base >> std::countr_zero(base);
+
+    if (odd == 1) {
+        return 1;
+    }
+
+    unsigned count = 1;
+    for (std::uint64_t value = 1; value <= limit / odd; value *= odd) {
+        ++count;
+    }
+    return count;
+}
+
+///
+/// Table of tables of powers `base^index` for all bases in range [2, 36], computed at
+/// compile time.
+///
+/// All tables are concatenated into one array, the offset and count of each base's table
+/// is looked up by the base itself.
+///
+/// @tparam T The value type of the table entries.
+/// @tparam CountF The functor returning the count of table entries for a base.
+///
+template <typename T, unsigned (*CountF)(unsigned)>
+class basic_power_table {
 public:
-    using value_type = IntT;
+    using value_type = T;
+
+    static constexpr unsigned MIN_BASE = 2;
+    static constexpr unsigned MAX_BASE = 36;
 
-    enum size_t { MAX_INDEX = convert::detail::digits_traits_v<value_type, Base> };
+private:
+    static constexpr std::size_t SIZE = []() {
+        std::size_t size = 0;
+        for (unsigned base = MIN_BASE; base <= MAX_BASE; ++base) {
+            size += CountF(base);
+        }
+        return size;
+    }();
 
 public:
-    constexpr power_table()
-    : array{ [](){
-        std::array<value_type, MAX_INDEX> data;
-        value_type value = 1;
-        for (auto i = 0U; i != MAX_INDEX; ++i) {
-            data[i] = value;
-            value *= Base;
+    constexpr basic_power_table()
+        : array{}
+        , offset{}
+        , count{}
+    {
+        std::size_t pos = 0;
+        for (unsigned base = MIN_BASE; base <= MAX_BASE; ++base) {
+            offset[base] = static_cast<std::uint16_t>(pos);
+            count[base] = static_cast<std::uint16_t>(CountF(base));
+            value_type value = 1;
+            for (unsigned i = 0; i != count[base]; ++i) {
+                array[pos++] = value;
+                if (i + 1 != count[base]) {
+                    value *= base;
+                }
+            }
         }
-        return data;
-    }() }
-    { }
+    }
 
-    value_type operator[](unsigned idx) const
+    constexpr value_type operator()(unsigned base, unsigned idx) const
     {
-        assert((idx < MAX_INDEX) && "exponent index out of range");
-        return array[idx];
+        assert((MIN_BASE <= base && base <= MAX_BASE) && "Base must be in range [2, 36]");
+        assert((idx < count[base]) && "exponent index out of range");
+        return array[offset[base] + idx];
     }
 
-    static unsigned max_index() { return MAX_INDEX; }
+    constexpr unsigned max_index(unsigned base) const
+    {
+        assert((MIN_BASE <= base && base <= MAX_BASE) && "Base must be in range [2, 36]");
+        return count[base];
+    }
 
 private:
-    std::array<value_type, MAX_INDEX> const array;
+    std::array<value_type, SIZE> array;
+    std::array<std::uint16_t, MAX_BASE + 1> offset;
+    std::array<std::uint16_t, MAX_BASE + 1> count;
 };
 
+///
+/// All powers `base^index` representable by the unsigned integer type.
+///
+template <UnsignedIntegralType IntT>
+using power_table = basic_power_table<IntT, power_count<IntT>>;
+
+///
+/// All powers `base^index` exactly representable by the real type.
+///
+template <RealType RealT>
+using real_power_table = basic_power_table<RealT, exact_power_count<RealT>>;
+
+///
+/// The instance of the table, also usable by constant evaluated functions, which can't
+/// have static variables.
+///
+template <RealType RealT>
+inline constexpr real_power_table<RealT> real_power_lut{};
+
 template <typename T>
 struct power_fu {
     static_assert(nostd::always_false<T>, "Must be of unsigned integer or real type");
@@ -72,100 +174,61 @@ static power_fu<T> const power = {};
 template <UnsignedIntegralType IntT>
 struct power_fu<IntT> {
     // FixMe: exp is int32_t, arg is unsigned!
-    IntT operator()(unsigned base, unsigned exp_index) const
+    constexpr IntT operator()(unsigned base, unsigned exp_index) const
     {
         LEAF_ERROR_TRACE;
 
-        auto const max_exp = [&](unsigned base) {
-            switch (base) {
-                case 2:
-                    return bin_lut.max_index();
-                case 8:
-                    return oct_lut.max_index();
-                case 10:
-                    return dec_lut.max_index();
-                case 16:
-                    return hex_lut.max_index();
-                default: {
-                    // Generic implementation for arbitrary bases
-                    // TODO make the math integer aware and even simpler
-                    auto const log = [](double base, double x) {
-                        return std::log10(x) / std::log10(base);
-                    };
-                    return static_cast<unsigned>(std::numeric_limits<IntT>::digits / log(2, base));
-                }
-            }
-        };
-
-        if (!(exp_index < max_exp(base))) {
+        if (!(exp_index < lut.max_index(base))) {
             // exponent base^index out of range or others
-            auto const ec = std::make_error_code(std::errc::value_too_large);
-            throw leaf::exception(ec, leaf::e_api_function{ "power<IntT>" });
+            throw leaf::exception(std::make_error_code(std::errc::value_too_large),
+                                  leaf::e_api_function{ "power<IntT>" });
         }
 
-        return call_with(base, exp_index);
+        return lut(base, exp_index);
     }
 
 private:
-    IntT call_with(unsigned base, unsigned exp) const
-    {
-        auto const get = [&](unsigned base, unsigned e) {
-            switch (base) {
-                case 2:
-                    return bin_lut[e];
-                case 8:
-                    return oct_lut[e];
-                case 10:
-                    return dec_lut[e];
-                case 16:
-                    return hex_lut[e];
-                default:
-                    // TODO check on max exponent
-                    return static_cast<IntT>(
-                        std::pow(static_cast<double>(base), static_cast<double>(e)));
-            }
-        };
-
-        return get(base, exp);
-    }
-
-private:
-    static constexpr auto bin_lut = power_table<IntT, 2U>{};
-    static constexpr auto oct_lut = power_table<IntT, 8U>{};
-    static constexpr auto dec_lut = power_table<IntT, 10U>{};
-    static constexpr auto hex_lut = power_table<IntT, 16U>{};
+    static constexpr auto lut = power_table<IntT>{};
 };
 
 template <RealType RealT>
 struct power_fu<RealT> {
-    RealT operator()(unsigned base, std::int32_t exp_index) const
+    ///
+    /// Correctly rounded power `base^exp_index`.
+    ///
+    /// @throws leaf::exception with `std::errc::result_out_of_range` if the result
+    /// overflows or underflows the real type.
+    ///
+    constexpr RealT operator()(unsigned base, std::int32_t exp_index) const
     {
-        // FIXME make it configurable/templated
-        using promote_type = std::uint32_t;
+        LEAF_ERROR_TRACE;
 
-        // TODO Check on max base and exponent
+        auto constexpr api_name = "power<RealT>";
 
-        auto const power_int = [&](unsigned base, std::int32_t exp) {
-            auto const exp_ = abs(exp);
+        if (std::has_single_bit(base)) {
+            // exact, it's a matter of the binary exponent only
+            auto const bits = static_cast<std::int64_t>(std::countr_zero(base));
+            // LEAF; the normalized mantissa of 2^(bits * exp_index)
+            return to_real<RealT>({ std::uint64_t{ 1 } << 63, bits * exp_index - 63, false },
+                                  api_name);
+        }
 
-            // check if exponent small enough so one can use integer table lookup
-            if (exp_ <= std::numeric_limits<promote_type>::digits10) {
-                auto const result = static_cast<RealT>(power<promote_type>(base, exp_));
-                if (exp > 0) {
-                    return result;
-                }
-                // otherwise exponent negative - shouldn't happen - pure paranoia
-                assert(result > 0 && "attempt to call division by zero");
-                return RealT{ 1 } / result;
-            }
-            else {  // > digits10
-                // TODO check on max exponent
-                return std::pow(static_cast<RealT>(base), static_cast<RealT>(exp));
-            }
-        };
+        auto const exp_ = static_cast<std::uint64_t>(
+            (exp_index < 0) ? -std::int64_t{ exp_index } : std::int64_t{ exp_index });
+
+        if (exp_ < lut.max_index(base)) {
+            // The table entry is exact, so is the reciprocal's IEEE division correctly
+            // rounded.
+            auto const result = lut(base, exp_);
+            return (exp_index < 0) ? RealT{ 1 } / result : result;
+        }
 
-        return power_int(base, exp_index);
+        // LEAF
+        return to_real<RealT>(power_mantissa(base, exp_index), api_name);
     }
+
+private:
+    static constexpr auto const& lut = real_power_lut<RealT>;
 };
 
 }  // namespace detail
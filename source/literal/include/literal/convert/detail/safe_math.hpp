@@ -15,7 +15,10 @@
 #include <type_traits>
 #include <limits>
 #include <cstdint>
-#include <cfenv>
+#include <cerrno>
+#include <cfenv>  // FE_* exception bits only
+#include <cmath>
+#include <utility>
 #include <system_error>
 #include <iostream>
 
@@ -64,6 +67,16 @@ using promote_t = typename promote<T>::type;
 // working on:https://godbolt.org/z/T7xeh7d6W
 // SO: https://stackoverflow.com/questions/73066724/cant-check-for-overflow-of-double-float-operations-by-use-of-machines-epsilon
 // Problem with overflow detection of double
+//
+// Note: The floating-point environment isn't used to detect errors of real operations,
+// since `std::feclearexcept()` and `std::fetestexcept()` are serializing accesses to the
+// FPU's control/status register (e.g. MXCSR on x86), which are much more expensive than
+// the arithmetic itself. Instead, the result is checked to be finite and in range. The
+// raised exceptions are reported by the same FE_* bits as before.
+
+#if defined(__GNUC__) || defined(__clang__)
+#define UTIL_SAFE_MATH_HAS_BUILTIN_OVERFLOW 1
+#endif
 
 // Select numeric implementation ((unsigned) integer and real)
 // concept see [Coliru](https://coliru.stacked-crooked.com/a/dd9e4543247597ad)
@@ -77,23 +90,86 @@ struct safe_add {
     static_assert(nostd::always_false<T>, "unsupported numeric type");
 };
 
-// To multiply type promotion is used; alternative for integer see
-// [Catch and compute overflow during multiplication of two large integers](
+[[noreturn]] static inline void throw_int_overflow(char const* api_name)
+{
+    auto const ec = std::make_error_code(std::errc::result_out_of_range);
+    throw leaf::exception(ec, leaf::e_api_function{ api_name });
+}
+
+[[noreturn]] static inline void throw_fp_exception(char const* api_name, int fp_exception_raised)
+{
+    // same mapping as the math library does, see math_errhandling
+    int const errc = (fp_exception_raised & FE_INVALID) != 0 ? EDOM : ERANGE;
+    auto const ec = std::error_code(errc, std::generic_category());
+    throw leaf::exception(ec, leaf::e_api_function{ api_name },
+                          leaf::e_fp_exception{ fp_exception_raised });
+}
+
+///
+/// Classify the result of a real operation, as the floating-point environment would do
+/// for overflow and invalid operation. Quiet NaN and infinite operands propagate without
+/// raising an exception.
+///
+/// @return The raised FE_* exceptions, or 0 if there are none.
+///
+template <RealType RealT>
+static inline int fp_exception_of(RealT lhs, RealT rhs, RealT result)
+{
+    if (std::isnan(result) && !std::isnan(lhs) && !std::isnan(rhs)) {
+        return FE_INVALID;
+    }
+    if (std::isinf(result) && std::isfinite(lhs) && std::isfinite(rhs)) {
+        return FE_OVERFLOW;
+    }
+    return 0;
+}
+
+// To multiply, compiler's builtin overflow checks are used, otherwise type promotion;
+// alternative for integer see [Catch and compute overflow during multiplication of two
+// large integers](
 //  https://stackoverflow.com/questions/1815367/catch-and-compute-overflow-during-multiplication-of-two-large-integers)
 template <IntegralType IntT>
 struct safe_mul<IntT> {
-    IntT operator()(IntT lhs, IntT rhs) const
+    constexpr IntT operator()(IntT lhs, IntT rhs) const
     {
         LEAF_ERROR_TRACE;
 
+#if defined(UTIL_SAFE_MATH_HAS_BUILTIN_OVERFLOW)
+        IntT result{};
+        if (__builtin_mul_overflow(lhs, rhs, &result)) {
+            throw_int_overflow("safe_mul<IntT>");
+        }
+        return result;
+#else
         auto const result = static_cast<promote_t<IntT>>(lhs) * rhs;
 
         if (result > std::numeric_limits<IntT>::max()) {
-            auto const ec = std::make_error_code(std::errc::result_out_of_range);
-            throw leaf::exception(ec, leaf::e_api_function{ "safe_mul<IntT>" });
+            throw_int_overflow("safe_mul<IntT>");
         }
 
         return static_cast<IntT>(result);
+#endif
+    }
+};
+
+template <IntegralType IntT>
+struct safe_add<IntT> {
+    constexpr IntT operator()(IntT lhs, IntT rhs) const
+    {
+        LEAF_ERROR_TRACE;
+
+#if defined(UTIL_SAFE_MATH_HAS_BUILTIN_OVERFLOW)
+        IntT result{};
+        if (__builtin_add_overflow(lhs, rhs, &result)) {
+            throw_int_overflow("safe_add<IntT>");
+        }
+        return result;
+#else
+        if (lhs > std::numeric_limits<IntT>::max() - rhs) {
+            throw_int_overflow("safe_add<IntT>");
+        }
+        return static_cast<IntT>(lhs + rhs);
+#endif
     }
 };
 
@@ -103,21 +179,46 @@ struct safe_mul<RealT> {
     {
         LEAF_ERROR_TRACE;
 
-        std::feclearexcept(FE_ALL_EXCEPT);
-
         auto const result = lhs * rhs;
 
-        int const fp_exception_raised = std::fetestexcept(FE_ALL_EXCEPT & ~FE_INEXACT);
+        // fast path: a normal result of finite operands doesn't raise anything
+        if (std::isnormal(result) || (result == 0 && (lhs == 0 || rhs == 0))) {
+            return result;
+        }
+
+        int const fp_exception_raised = std::isfinite(result)  //
+                                            ? underflow(lhs, rhs, result)
+                                            : fp_exception_of(lhs, rhs, result);
 
         if (fp_exception_raised) {
-            std::feclearexcept(FE_ALL_EXCEPT);
-            auto const ec = std::error_code(errno, std::generic_category());
-            throw leaf::exception(ec, leaf::e_api_function{ "safe_mul<RealT>" },
-                                  leaf::e_fp_exception{ fp_exception_raised });
+            throw_fp_exception("safe_mul<RealT>", fp_exception_raised);
         }
 
         return result;
     }
+
+private:
+    // An underflow is raised if the result is tiny and inexact.
+    static int underflow(RealT lhs, RealT rhs, RealT result)
+    {
+        // A product of nonzero operands rounded to zero is inexact, even if the scaled
+        // error term below underflows to zero too.
+        if (result == 0) {
+            return FE_UNDERFLOW;
+        }
+
+        // Scale the smaller operand into the range, where the product's rounding error is
+        // representable; scaling by powers of 2 is exact here.
+        static int constexpr scale = 3 * std::numeric_limits<RealT>::digits;
+
+        auto const [small, large] = (std::fabs(lhs) < std::fabs(rhs))  //
+                                        ? std::pair{ lhs, rhs }
+                                        : std::pair{ rhs, lhs };
+
+        auto const error = std::fma(std::ldexp(small, scale), large, -std::ldexp(result, scale));
+
+        return (error != 0) ? FE_UNDERFLOW : 0;
+    }
 };
 
 template <RealType RealT>
@@ -126,17 +227,13 @@ struct safe_add<RealT> {
     {
         LEAF_ERROR_TRACE;
 
-        std::feclearexcept(FE_ALL_EXCEPT);
-
         auto const result = lhs + rhs;
 
-        int const fp_exception_raised = std::fetestexcept(FE_ALL_EXCEPT & ~FE_INEXACT);
+        // A sum of finite operands can't underflow, subnormal sums are always exact.
+        int const fp_exception_raised = fp_exception_of(lhs, rhs, result);
 
         if (fp_exception_raised) {
-            std::feclearexcept(FE_ALL_EXCEPT);
-            auto const ec = std::error_code(errno, std::generic_category());
-            throw leaf::exception(ec, leaf::e_api_function{ "safe_add<RealT>" },
-                                  leaf::e_fp_exception{ fp_exception_raised });
+            throw_fp_exception("safe_add<RealT>", fp_exception_raised);
         }
 
         return result;
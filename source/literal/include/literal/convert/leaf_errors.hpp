@@ -138,6 +138,8 @@ struct e_error_trace
 
 }  // namespace boost::leaf
 
+// Note: `leaf::on_error()` isn't constexpr, with USE_LEAF_ERROR_TRACE the conversion
+// functions aren't usable in constant evaluation, e.g. by `convert::literal_value()`.
 #if defined(USE_LEAF_ERROR_TRACE)
 #define LEAF_ERROR_TRACE auto leaf_trace_ = \
     ::boost::leaf::on_error([](::boost::leaf::e_error_trace& trace) { \
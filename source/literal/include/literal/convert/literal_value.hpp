@@ -0,0 +1,174 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <literal/convert/convert.hpp>
+#include <literal/convert/detail/constraint_types.hpp>
+
+#include <boost/leaf/exception.hpp>
+#include <boost/leaf/common.hpp>
+#include <literal/convert/leaf_errors.hpp>
+
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+namespace convert {
+
+namespace detail {
+
+///
+/// The parts of a numeric literal's spelling.
+///
+struct literal_spelling {
+    unsigned base = 10;
+    std::string_view integer;
+    std::string_view fractional;
+    std::string_view exponent;
+    bool is_real = false;
+    bool is_bit_string = false;
+};
+
+// Intentionally not constexpr: reached by constant evaluation, the compiler's diagnostic
+// points to here.
+[[noreturn]] inline void malformed_literal_spelling(char const* where)
+{
+    auto const ec = std::make_error_code(std::errc::invalid_argument);
+    throw leaf::exception(ec, leaf::e_api_function{ "literal_value" },
+                          leaf::e_position_iterator{ where });
+}
+
+///
+/// Split the spelling of a VHDL numeric literal into it's parts, the digits itself are
+/// checked by the conversion. Supported are decimal literals (`42`, `1_000`, `1.5E-3`),
+/// based literals (`16#AFFE#`, `2#1.1#E+4`, also with the replacement character ':') and
+/// bit string literals (`X"AFFE"`, `O"17"`, `B"1010_1010"`).
+///
+constexpr literal_spelling split_literal_spelling(std::string_view spelling)
+{
+    literal_spelling result;
+
+    if (spelling.size() >= 3 && spelling[1] == '"' && spelling.back() == '"') {
+        switch (spelling.front()) {
+            case 'B':
+            case 'b':
+                result.base = 2;
+                break;
+            case 'O':
+            case 'o':
+                result.base = 8;
+                break;
+            case 'X':
+            case 'x':
+                result.base = 16;
+                break;
+            default:
+                malformed_literal_spelling(spelling.data());
+        }
+        result.integer = spelling.substr(2, spelling.size() - 3);
+        result.is_bit_string = true;
+        return result;
+    }
+
+    std::string_view mantissa = spelling;
+    std::string_view exponent_part;
+
+    if (auto const open = spelling.find_first_of("#:"); open != std::string_view::npos) {
+        auto const close = spelling.find(spelling[open], open + 1);
+        if (open == 0 || close == std::string_view::npos) {
+            malformed_literal_spelling(spelling.data() + open);
+        }
+        // LEAF
+        result.base = as_integral_integer<std::uint32_t>(10U, spelling.substr(0, open));
+        if (!(2 <= result.base && result.base <= 36)) {
+            malformed_literal_spelling(spelling.data());
+        }
+        mantissa = spelling.substr(open + 1, close - open - 1);
+        exponent_part = spelling.substr(close + 1);
+    }
+    else if (auto const exp = spelling.find_first_of("Ee"); exp != std::string_view::npos) {
+        mantissa = spelling.substr(0, exp);
+        exponent_part = spelling.substr(exp);
+    }
+
+    if (!exponent_part.empty()) {
+        if (exponent_part.size() < 2 || (exponent_part[0] != 'E' && exponent_part[0] != 'e')) {
+            malformed_literal_spelling(exponent_part.data());
+        }
+        result.exponent = exponent_part.substr(1);
+    }
+
+    if (auto const dot = mantissa.find('.'); dot != std::string_view::npos) {
+        result.integer = mantissa.substr(0, dot);
+        result.fractional = mantissa.substr(dot + 1);
+        result.is_real = true;
+        if (result.integer.empty() || result.fractional.empty()) {
+            malformed_literal_spelling(mantissa.data() + dot);
+        }
+    }
+    else {
+        result.integer = mantissa;
+    }
+
+    if (result.integer.empty()) {
+        malformed_literal_spelling(spelling.data());
+    }
+
+    return result;
+}
+
+template <typename T>
+constexpr T literal_value_of(std::string_view spelling)
+{
+    // LEAF
+    auto const parts = split_literal_spelling(spelling);
+
+    if constexpr (RealType<T>) {
+        if (!parts.is_real) {
+            malformed_literal_spelling(spelling.data());
+        }
+        // LEAF
+        return real_value<T>(parts.base, parts.integer, parts.fractional, parts.exponent);
+    }
+    else {
+        if (parts.is_real) {
+            malformed_literal_spelling(spelling.data());
+        }
+        if (parts.is_bit_string) {
+            // LEAF
+            return bit_string_value<T>(parts.base, parts.integer);
+        }
+        // LEAF
+        return integer_value<T>(parts.base, parts.integer, parts.exponent);
+    }
+}
+
+}  // namespace detail
+
+///
+/// Compile time conversion of a VHDL numeric literal's spelling into its value, e.g.
+///
+/// @code{.cpp}
+/// static_assert(convert::literal_value<std::uint32_t>("16#AFFE#") == 0xAFFE);
+/// static_assert(convert::literal_value<double>("1.5E-3") == 1.5e-3);
+/// @endcode
+///
+/// Integer and bit string literals are converted into unsigned integer, real literals
+/// into real types. Malformed literals, wrong digits and numeric overflow are compile
+/// errors.
+///
+/// @note Constant evaluation of reals is limited to decimal literals, which are exact on
+/// the fast path of @ref detail::decimal_real; all other real literals aren't constant
+/// expressions.
+///
+template <typename T>
+    requires UnsignedIntegralType<T> || RealType<T>
+consteval T literal_value(std::string_view spelling)
+{
+    return detail::literal_value_of<T>(spelling);
+}
+
+}  // namespace convert
@@ -5,6 +5,9 @@
 
 #pragma once
 
+// X3's is_substitute.hpp isn't self-contained, the traits must be declared before
+#include <boost/spirit/home/x3/support/traits/is_variant.hpp>
+#include <boost/spirit/home/x3/support/traits/tuple_traits.hpp>
 #include <boost/spirit/home/x3/directive/expect.hpp>  // x3::expectation_failure
 
 #include <literal/convert/leaf_errors.hpp>
@@ -0,0 +1,67 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <iosfwd>
+
+namespace convert {
+
+///
+/// Arbitrary-width, packed representation of a bit string literal value.
+///
+/// The bits are stored little-endian in 64-bit words, i.e. bit `i` of the value is
+/// bit `i % 64` of `words[i / 64]`. The least significant bit is the last bit of the
+/// literal. The unused upper bits of the last word are always zero.
+///
+/// The bit length is determined by the digits of the literal, not by the value; VHDL
+/// bit strings are vectors, hence leading zeros count, e.g. `x"00F"` has 12 bits.
+///
+/// The words are allocated from the given memory resource, which allows to use an arena
+/// (e.g. `std::pmr::monotonic_buffer_resource`) for the parse session.
+///
+struct packed_bits {
+    using word_type = std::uint64_t;
+    using allocator_type = std::pmr::polymorphic_allocator<word_type>;
+
+    static constexpr std::size_t word_bits = 64;
+
+    packed_bits() = default;
+
+    explicit packed_bits(allocator_type const& alloc)
+        : words(alloc)
+    {
+    }
+
+    /// number of words required to hold `bit_count` bits
+    static constexpr std::size_t words_for(std::size_t bit_count)
+    {
+        return (bit_count + word_bits - 1) / word_bits;
+    }
+
+    /// test bit at position `idx`, where index 0 is the least significant bit
+    bool test(std::size_t idx) const
+    {
+        return ((words[idx / word_bits] >> (idx % word_bits)) & 1U) != 0;
+    }
+
+    std::size_t size() const { return bit_length; }
+
+    bool empty() const { return bit_length == 0; }
+
+    std::pmr::vector<word_type> words;
+    std::size_t bit_length = 0;
+};
+
+bool operator==(packed_bits const& lhs, packed_bits const& rhs);
+
+/// Print as hexadecimal bit string, e.g. `12x"00F"`
+std::ostream& operator<<(std::ostream& os, packed_bits const& bits);
+
+}  // namespace convert
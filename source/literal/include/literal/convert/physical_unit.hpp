@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <literal/ast.hpp>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace convert {
+
+///
+/// A unit of a physical type, the scale is the count of the primary unit.
+///
+struct physical_unit {
+    std::string_view name;
+    std::int64_t scale;
+};
+
+namespace detail {
+
+/// VHDL identifiers are case insensitive
+constexpr bool unit_name_equal(std::string_view lhs, std::string_view rhs)
+{
+    auto const to_lower = [](char chr) {
+        return ('A' <= chr && chr <= 'Z') ? static_cast<char>(chr - 'A' + 'a') : chr;
+    };
+
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i != lhs.size(); ++i) {
+        if (to_lower(lhs[i]) != to_lower(rhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace detail
+
+///
+/// The units of a physical type, by default those of the predefined type TIME with the
+/// primary unit fs. Further units can be registered as by VHDL's secondary unit
+/// declaration, e.g. `unit_table.add("day", 24, "hr")`.
+///
+class unit_table {
+public:
+    ///
+    /// The units of the predefined type TIME, IEEE Std 1076-2008 16.3.
+    ///
+    static constexpr std::array<physical_unit, 8> time_units = { {
+        { "fs", 1 },
+        { "ps", 1'000 },
+        { "ns", 1'000'000 },
+        { "us", 1'000'000'000 },
+        { "ms", 1'000'000'000'000 },
+        { "sec", 1'000'000'000'000'000 },
+        { "min", 60'000'000'000'000'000 },
+        { "hr", 3'600'000'000'000'000'000 },
+    } };
+
+    ///
+    /// Compile time lookup of the TIME unit's scale in fs.
+    ///
+    static constexpr std::optional<std::int64_t> time_unit_scale(std::string_view name)
+    {
+        for (auto const& unit : time_units) {
+            if (detail::unit_name_equal(unit.name, name)) {
+                return unit.scale;
+            }
+        }
+        return std::nullopt;
+    }
+
+public:
+    ///
+    /// Register the secondary unit `name = multiplier unit_name`.
+    ///
+    /// @throws leaf::exception with `std::errc::invalid_argument` if the unit is already
+    /// known or the unit_name isn't, and `std::errc::result_out_of_range` if the
+    /// scale overflows.
+    ///
+    void add(std::string_view name, std::int64_t multiplier, std::string_view unit_name);
+
+    ///
+    /// The scale of the unit as count of the primary unit, nothing if the unit is unknown.
+    ///
+    std::optional<std::int64_t> scale_of(std::string_view name) const;
+
+private:
+    struct user_unit {
+        std::string name;
+        std::int64_t scale;
+    };
+
+    std::vector<user_unit> user_units;
+};
+
+///
+/// Normalize the physical literal into an exact count of the primary unit, e.g.
+/// `1.5 ns` into 1'500'000 fs.
+///
+/// Integer magnitudes are scaled exactly. Real magnitudes are rounded to the nearest
+/// integer count (ties to even); decimal reals of up to 19 significant digits are
+/// scaled exactly, all others by their 64 bit binary mantissa. A physical literal
+/// without abstract literal counts as 1.
+///
+/// @throws leaf::exception with `std::errc::invalid_argument` on unknown unit, and
+/// `std::errc::result_out_of_range` if the count overflows 64 bit.
+///
+struct convert_physical_literal {
+    std::int64_t operator()(ast::physical_literal const& literal,
+                            unit_table const& units = {}) const;
+};
+
+static convert_physical_literal const physical_literal = {};
+
+}  // namespace convert
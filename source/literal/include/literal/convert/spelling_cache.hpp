@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <literal/ast.hpp>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace convert {
+
+///
+/// Per thread cache of converted values, keyed by the normalized spelling of the literal.
+///
+/// Generated VHDL repeats the same numeric spellings (`0`, `1`, `16#FF#`, ...) very often,
+/// which don't need to be converted again. The cache is a small, fixed-size open
+/// addressing table without any allocation; on collision an old entry is evicted. Spellings
+/// longer than @ref MAX_KEY_SIZE aren't cached at all.
+///
+/// The cache is disabled by default, @see enable().
+///
+class spelling_cache {
+public:
+    static constexpr std::size_t CAPACITY = 1024;
+    static constexpr std::size_t MAX_KEY_SIZE = 38;
+
+    struct statistics {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        /// spellings, which aren't cacheable, since they are too long
+        std::size_t bypassed = 0;
+
+        double hit_rate() const
+        {
+            auto const lookups = hits + misses;
+            return lookups != 0 ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+        }
+    };
+
+    ///
+    /// The normalized spelling: kind, base and digits, where the delimiter '_' are removed
+    /// and letters are lower case.
+    ///
+    struct key_type {
+        std::uint64_t hash;
+        std::uint8_t size;
+        std::array<char, MAX_KEY_SIZE> chars;
+    };
+
+public:
+    /// Enable or disable the cache for all threads.
+    static void enable(bool on) { enabled_flag.store(on, std::memory_order_relaxed); }
+
+    static bool enabled() { return enabled_flag.load(std::memory_order_relaxed); }
+
+    /// The cache of the calling thread.
+    static spelling_cache& thread_instance();
+
+    /// The key of the literal's spelling, or nothing if it's too long to be cached.
+    std::optional<key_type> make_key(ast::real_type const& real);
+    std::optional<key_type> make_key(ast::integer_type const& int_);
+    std::optional<key_type> make_key(ast::bit_string_literal const& literal);
+
+    std::optional<std::uint64_t> find(key_type const& key);
+    void insert(key_type const& key, std::uint64_t value);
+
+    void clear();
+
+    statistics const& stats() const { return the_stats; }
+
+private:
+    struct entry {
+        key_type key;
+        std::uint64_t value;
+        bool used;
+    };
+
+    std::optional<key_type> counted(std::optional<key_type> const& key);
+
+    static bool equal(key_type const& lhs, key_type const& rhs);
+
+private:
+    static constexpr std::size_t MAX_PROBES = 4;
+
+    static inline std::atomic<bool> enabled_flag = false;
+
+    std::array<entry, CAPACITY> table{};
+    statistics the_stats;
+};
+
+///
+/// Convert the literal node, or take the value of the same spelling from the thread's
+/// @ref spelling_cache, if enabled.
+///
+template <typename NodeT, typename ConvertF>
+typename NodeT::value_type cached(NodeT const& node, ConvertF const& convert_fn)
+{
+    using value_type = typename NodeT::value_type;
+
+    if (!spelling_cache::enabled()) {
+        // LEAF
+        return convert_fn(node);
+    }
+
+    auto& cache = spelling_cache::thread_instance();
+    auto const key = cache.make_key(node);
+
+    if (key) {
+        if (auto const bits = cache.find(*key); bits) {
+            if constexpr (std::is_floating_point_v<value_type>) {
+                return std::bit_cast<value_type>(*bits);
+            }
+            else {
+                return static_cast<value_type>(*bits);
+            }
+        }
+    }
+
+    // LEAF
+    auto const value = convert_fn(node);
+
+    if (key) {
+        if constexpr (std::is_floating_point_v<value_type>) {
+            static_assert(sizeof(value_type) == sizeof(std::uint64_t));
+            cache.insert(*key, std::bit_cast<std::uint64_t>(value));
+        }
+        else {
+            cache.insert(*key, static_cast<std::uint64_t>(value));
+        }
+    }
+
+    return value;
+}
+
+}  // namespace convert
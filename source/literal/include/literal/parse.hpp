@@ -6,9 +6,24 @@
 #pragma once
 
 #include <literal/ast.hpp>
+#include <literal/parser/parse_limits.hpp>
 
 #include <string>
 
-bool parse(std::string const& input, ast::literals& literals, std::ostream& os);
+///
+/// The parse mode of the literal statements.
+///
+enum class parse_mode {
+    x3,        ///< the X3 grammar only
+    fast_scan  ///< table driven scanner, with X3 grammar fallback on unrecognized statements
+};
+
+///
+/// Parse the literal statements of the input, where the lexemes are bounded by the
+/// limits of this parse session.
+///
+bool parse(std::string const& input, ast::literals& literals, std::ostream& os,
+           parse_mode mode = parse_mode::x3,
+           parser::parse_limits const& limits = parser::parse_limits{});
 
 void reset_error_counter();
@@ -15,6 +15,14 @@ namespace parser {
 
 namespace x3 = boost::spirit::x3;
 
+namespace detail {
+
+static auto const abstract_literal_grammar = x3::lexeme [
+    based_literal | decimal_literal
+];
+
+}  // namespace detail
+
 // BNF: abstract_literal ::= decimal_literal | based_literal
 // Note: {decimal, based}_literal's AST nodes does have same memory layout!
 struct abstract_literal_parser : x3::parser<abstract_literal_parser> {
@@ -26,11 +34,7 @@ struct abstract_literal_parser : x3::parser<abstract_literal_parser> {
     {
         skip_over(first, last, ctx);
 
-        auto const grammar = x3::lexeme [
-            based_literal | decimal_literal
-        ];
-
-        auto const parse_ok = x3::parse(first, last, grammar, attribute);
+        auto const parse_ok = x3::parse(first, last, detail::abstract_literal_grammar, attribute);
 
         if (!parse_ok) {
             return false;
@@ -7,6 +7,7 @@
 
 #include <literal/ast.hpp>
 #include <literal/parser/char_parser.hpp>
+#include <literal/parser/decimal_literal.hpp>
 #include <literal/parser/error_handler.hpp>
 #include <literal/convert/leaf_error_handler.hpp>
 #include <literal/convert/convert.hpp>
@@ -37,35 +38,18 @@ inline bool vhdl_supported_base(unsigned base) {
     return base == 2U || base == 8U || base == 10U || base == 16U;
 }
 
-template <typename IteratorT>
+///
+/// The delimited digits parser of the given base, which is selected from the compile time
+/// specialized digit scanners, see @ref char_parser::delimited_digits_parser.
+///
 struct based_digits_parser {
-    auto operator()(unsigned base, char const* name = "based integer") const
+    auto operator()(unsigned base) const
     {
-        using namespace char_parser;
-
-        auto const as = [](auto&& parser) {
-            return x3::any_parser<IteratorT, std::string>{ x3::as_parser(parser) };
-        };
-
-        switch (base) {
-            // NOLINTNEXTLINE(bugprone-branch-clone)
-            case 2:
-                return as(bin_digits);
-            case 8:
-                return as(oct_digits);
-            case 10:
-                return as(dec_digits);
-            case 16:
-                return as(hex_digits);
-            default:
-                // any other base
-                return as(delimit_numeric_digits(based_charset(base), name));
-        }
+        return char_parser::delimited_digits(base);
     }
 };
 
-template <typename IteratorT>
-static based_digits_parser<IteratorT> const base_digits = {};
+static based_digits_parser const base_digits = {};
 
 // BNF base ::= integer
 struct based_base_specifier_parser : x3::parser<based_base_specifier_parser> {
@@ -79,37 +63,20 @@ struct based_base_specifier_parser : x3::parser<based_base_specifier_parser> {
     {
         LEAF_ERROR_TRACE;
 
-        auto const begin = first;
-
-        std::string base_literal_str;
-        bool const parse_ok = x3::parse(first, last, char_parser::dec_digits, base_literal_str);
-
-        if (!parse_ok) {
+        // The base specifier's value is required only, without any string. The digits are
+        // accumulated while parsing, hence the parser doesn't allocate, even on backtracking
+        // of the decimal literal alternative.
+        char_parser::accumulated_digits<unsigned> base_digits;
+        if (!x3::parse(first, last, char_parser::accumulate_digits<unsigned>(10U), base_digits)) {
             return false;
         }
 
-        // convert parse result into base specifier and use `with` directive to
-        // inject this value into the Spirit X3 context. Base specifier is required to select
-        // correct character based_{real, integer} parser later.
-        return leaf::try_catch(
-            [&] {
-                // base specifier is always decimal
-                static constexpr auto const base10 = 10U;
-
-                auto load = leaf::on_error(leaf::e_x3_parser_context{*this, first, begin});
-
-                // from_chars() may fail
-                auto const base_result =
-                    convert::detail::as_integral_integer<unsigned>(base10, base_literal_str);
-
-                x3::get<detail::based_integer_base_tag>(ctx) = base_result;
-
-                // Note: here, no check for a valid base can take place, because this parser
-                // is called also for other rules due to parser alternatives (namely decimal literal).
-
-                return true;
-            },
-            convert::leaf_error_handlers<IteratorT>);
+        // Note: here, no check for a valid base can take place, because this parser is called
+        // also for other rules due to parser alternatives (namely decimal literal). An
+        // overflowing base is invalid anyway, it's checked later.
+        x3::get<detail::based_integer_base_tag>(ctx) =
+            base_digits.overflow_offset ? 0U : base_digits.value;
+        return true;
     }
 };
 
@@ -128,18 +95,35 @@ struct based_integer_parser : x3::parser<based_integer_parser> {
         // Note: the base has been initialized by outer rule before
         attribute.base = x3::get<detail::based_integer_base_tag>(ctx);
 
-        auto const based_integer = base_digits<IteratorT>(attribute.base);
-        using detail::unsigned_exp;
+#if defined(USE_FUSED_PARSER_CONVERT)
+        auto const begin = first;
+
+        if (!char_parser::valid_base(attribute.base)) {
+            return false;
+        }
 
-        auto const grammar =  // use lexeme[] from outer parser
-            based_integer >> '#' >> -unsigned_exp;
+        return leaf::try_catch(
+            [&] {
+                auto load = leaf::on_error(leaf::e_x3_parser_context{*this, first, begin});
 
-        auto const parse_ok = x3::parse(first, last, grammar, attribute);
+                // LEAF - overflow, or power() may fail
+                return parse_fused_integer(first, last, attribute.base, x3::lit('#'), attribute);
+            },
+            convert::leaf_error_handlers<IteratorT>);
+#else
+        [[maybe_unused]] auto const begin = first;
 
-        if (!parse_ok) {
+        // use lexeme[] from outer parser
+        digit_run<IteratorT> integer;
+        digit_run<IteratorT> exponent;
+        if (!scan_integer_literal(first, last, attribute.base, x3::lit('#'), integer,
+                                  exponent)) {
             return false;
         }
 
+        attribute.integer.assign(integer.first, integer.last);
+        attribute.exponent.assign(exponent.first, exponent.last);
+
 #if defined(USE_IN_PARSER_CONVERT)
         return leaf::try_catch(
             [&] {
@@ -153,6 +137,7 @@ struct based_integer_parser : x3::parser<based_integer_parser> {
 #else
         return true;
 #endif
+#endif  // USE_FUSED_PARSER_CONVERT
     }
 };
 
@@ -170,18 +155,21 @@ struct based_real_parser : x3::parser<based_real_parser> {
         // Note: the base has been initialized by outer rule before
         attribute.base = x3::get<detail::based_integer_base_tag>(ctx);
 
-        auto const based_integer = base_digits<IteratorT>(attribute.base);
-        using detail::signed_exp;
-
-        auto const grammar = // use lexeme[] from outer parser
-            based_integer >> '.' >> x3::expect[based_integer] >> '#' >> -signed_exp;
+        [[maybe_unused]] auto const begin = first;
 
-        auto const parse_ok = x3::parse(first, last, grammar, attribute);
-
-        if (!parse_ok) {
+        // use lexeme[] from outer parser
+        digit_run<IteratorT> integer;
+        digit_run<IteratorT> fractional;
+        digit_run<IteratorT> exponent;
+        if (!scan_real_literal(first, last, attribute.base, x3::lit('#'), integer, fractional,
+                               exponent)) {
             return false;
         }
 
+        attribute.integer.assign(integer.first, integer.last);
+        attribute.fractional.assign(fractional.first, fractional.last);
+        attribute.exponent.assign(exponent.first, exponent.last);
+
 #if defined(USE_IN_PARSER_CONVERT)
         return leaf::try_catch(
             [&] {
@@ -200,6 +188,31 @@ struct based_real_parser : x3::parser<based_real_parser> {
 
 static based_real_parser const based_real = {};
 
+// clang-format off
+static auto const reasonable_base = x3::rule<struct reasonable_base_class>{ "valid base specifier" } = x3::eps[
+    ([](auto const& ctx){
+        auto const parsed_base = x3::get<detail::based_integer_base_tag>(ctx);
+        auto const result = char_parser::valid_base(parsed_base);
+        _pass(ctx) = result;
+        return result;
+    })];
+// clang-format on
+
+// This parser is tricky. The base of the literal determines the following, actual literal
+// parser regarding the charset. Therefore the parser has three parts. The result of the base
+// parser is stored in the (local) context and fetched later. In between is the check for a valid
+// base range. The context's base specifier must be injected by the `with` directive of the
+// caller, since this grammar is built once and shared.
+
+// FIXME The expect directive for valid base specifier works, but the error location indicator
+// shows to the (too late) iterator position. Hence the error message isn't such intuitive.
+
+// clang-format off
+static auto const based_literal_grammar = x3::lexeme[
+    based_base_specifier >> '#' >> x3::expect[ reasonable_base ] >> (based_real | based_integer)
+];
+// clang-format on
+
 }  // namespace detail
 
 // BNF: based_literal ::= base # based_integer [ . based_integer ] # [ exponent ]
@@ -212,36 +225,14 @@ struct based_literal_parser : x3::parser<based_literal_parser> {
     {
         skip_over(first, last, ctx);
 
-        using detail::based_base_specifier;
-        using detail::based_integer;
-        using detail::based_real;
-
         //std::cout << "based_literal_parser: '" << detail::safe_sv(first,last) << "'\n";
 
-        auto const reasonable_base = x3::rule<struct _>{ "valid base specifier" } = x3::eps[
-            ([&](auto const& ctx){
-                auto const parsed_base = x3::get<detail::based_integer_base_tag>(ctx);
-                auto const result = char_parser::valid_base(parsed_base);
-                //std::cout << "based_literal_parser valid base: " << std::boolalpha << result << '\n';
-                _pass(ctx) = result;
-                return result;
-            })];
-
-        // This parser is tricky. The base of the literal determines the following, actual literal
-        // parser regarding the charset. Therefore the parser has three parts. The result of the base
-        // parser is stored in the (local) context and fetched later. In between is the check for a valid
-        // base range.
-
-        // FIXME The expect directive for valid base specifier works, but the error location indicator
-        // shows to the (too late) iterator position. Hence the error message isn't such intuitive.
-
-        // clang-format off
-        auto const grammar = x3::with<detail::based_integer_base_tag>(unsigned{} /* base specifier */)[
-            x3::lexeme[
-                based_base_specifier >> '#' >> x3::expect[ reasonable_base ] >> (based_real | based_integer)
-            ]
-        ];
-        // clang-format on
+        // The base specifier's value, written by based_base_specifier and read by the
+        // following parsers. It's held here, since the grammar is shared.
+        unsigned base_specifier = 0;
+
+        auto const grammar =
+            x3::with<detail::based_integer_base_tag>(base_specifier)[ detail::based_literal_grammar ];
 
         auto const parse_ok = x3::parse(first, last, grammar, attribute);
 
@@ -12,15 +12,50 @@
 #include <literal/convert/leaf_error_handler.hpp>
 
 #include <boost/spirit/home/x3.hpp>
-#include <literal/parser/util/x3_lazy.hpp>
 
-#include <iostream>
+#include <cstdint>
+#include <string>
 
 namespace parser {
 
 namespace x3 = boost::spirit::x3;
 namespace leaf = boost::leaf;
 
+namespace detail {
+
+// clang-format off
+static x3::symbols<std::uint32_t> const bit_string_base_id({
+    { "b", 2 },
+    { "o", 8 },
+    { "x", 16 },
+}, "base id");
+
+static auto const bit_string_base_specifier = x3::rule<struct bit_string_base_specifier_class, std::uint32_t>{ "base specifier" } =
+    x3::no_case[ bit_string_base_id ] >> '"';
+// clang-format on
+
+///
+/// Parse the optional bit value by the digit parser of the base, where the base selects
+/// one of the compile time digit parsers.
+///
+template <typename IteratorT>
+bool parse_bit_value(IteratorT& first, IteratorT const& last, std::uint32_t base,
+                     std::string& bit_value)
+{
+    switch (base) {
+        case 2:
+            return x3::parse(first, last, -char_parser::bin_digits, bit_value);
+        case 8:
+            return x3::parse(first, last, -char_parser::oct_digits, bit_value);
+        case 16:
+            return x3::parse(first, last, -char_parser::hex_digits, bit_value);
+        default:
+            return false;
+    }
+}
+
+}  // namespace detail
+
 // BNF: bit_string_literal ::= base_specifier " [ bit_value ] "
 // ATTENTION:  In VHDL-1993 hexadecimal bit-string literals always contain a
 // multiple of 4 bits, and octal ones a multiple of 3 bits. VHDL-2008 they may have:
@@ -34,43 +69,26 @@ struct bit_string_literal_parser : x3::parser<bit_string_literal_parser> {
     bool parse(IteratorT& first, IteratorT const& last, [[maybe_unused]] ContextT const& ctx,
                x3::unused_type, attribute_type& attribute) const
     {
-        using rule_type = x3::any_parser<IteratorT, std::string>;
-        using char_parser::bin_digits;
-        using char_parser::hex_digits;
-        using char_parser::oct_digits;
-        using x3e::do_lazy;
-        using x3e::set_lazy;
-
         skip_over(first, last, ctx);
 
-        // clang-format off
-        x3::symbols<rule_type> const bit_value_parser ({
-            {"b", bin_digits},
-            {"o", oct_digits},
-            {"x", hex_digits},
-        }, "bit value");
-
-        auto const bit_value = x3::rule<struct _, rule_type>{ "based digits" } =
-            x3::no_case[ bit_value_parser ];
-
-        auto const base_specifier = x3::rule<struct _, std::uint32_t>{ "base specifier" } =
-            x3::no_case[ base_id ];
+        [[maybe_unused]] auto const begin = first;
+        auto iter = first;
 
-        // clang-format off
-        auto const grammar = x3::rule<struct _, attribute_type, true>{ "bit string literal" } =
-            x3::with<rule_type>( rule_type{} )[
-                x3::lexeme[
-                       &set_lazy<rule_type>[ bit_value ] >> base_specifier
-                    >> '"' >> -do_lazy<rule_type> >> '"'
-                ]
-            ];
-        // clang-format on
+        // lexeme: base_specifier " [ bit_value ] "
+        if (!x3::parse(iter, last, detail::bit_string_base_specifier, attribute.base)) {
+            return false;
+        }
 
-        auto const parse_ok = x3::parse(first, last, grammar, attribute);
+        if (!detail::parse_bit_value(iter, last, attribute.base, attribute.literal)) {
+            return false;
+        }
 
-        if (!parse_ok) {
+        if (iter == last || *iter != '"') {
             return false;
         }
+
+        first = ++iter;
+
 #if defined(USE_IN_PARSER_CONVERT)
         return leaf::try_catch(
             [&] {
@@ -85,15 +103,6 @@ struct bit_string_literal_parser : x3::parser<bit_string_literal_parser> {
         return true;
 #endif
     }
-
-private:
-    // clang-format off
-    x3::symbols<std::uint32_t> const base_id = x3::symbols<std::uint32_t>({
-        { "b", 2 },
-        { "o", 8 },
-        { "x", 16 },
-    }, "base id");
-    // clang-format on
 };
 
 static bit_string_literal_parser const bit_string_literal = {};
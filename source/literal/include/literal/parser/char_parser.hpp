@@ -12,11 +12,22 @@
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/algorithm/copy_n.hpp>
 
+#include <literal/parser/parse_limits.hpp>
+#include <literal/parser/util/simd_scan.hpp>
+#include <literal/convert/detail/chr2dec.hpp>
 #include <literal/convert/detail/constraint_types.hpp>
 
+#include <array>
 #include <string_view>
 #include <string>
 #include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
 #include <iostream>
 
 namespace parser {
@@ -32,24 +43,30 @@ inline bool valid_base(unsigned base) {
     return (2U <= base && base <= 36U);
 }
 
-#if 0
-// FixMe: Limit digits, see [Misunderstanding repeat directive - it should fail, but doesn't](
-// https://stackoverflow.com/questions/72915071/misunderstanding-repeat-directive-it-should-fail-but-doesnt/72916318#72916318)
-//auto const delimit_numeric_digits = []<typename T>(auto&& char_range, char const* name = "numeric digits" ) 
-static auto const delimit_numeric_digits = [](auto&& char_range, char const* name = "numeric digits" ) 
+///
+/// The name of the base's digits, e.g. for diagnostics.
+///
+inline char const* digits_name(unsigned base)
 {
-    using T = double;
-    auto constexpr max = std::numeric_limits<T>::max_digits10 * 2 - 1;
-    decltype(max) constexpr min = 0;
-    auto const chars = x3::char_(char_range);
-    // clang-format off
-    return x3::rule<struct _, std::string>{ name } = // x3::lexeme from outer rule
-           x3::raw[chars >> x3::repeat(min, max)[('_' >> +chars | chars)]]
-        >> !(chars | '_')
-    ;
-    // clang-format on
-};
-#else
+    switch (base) {
+        case 2:
+            return "binary digits";
+        case 8:
+            return "octal digits";
+        case 10:
+            return "decimal digits";
+        case 16:
+            return "hexadecimal digits";
+        default:
+            return "based integer";
+    }
+}
+
+///
+/// Delimited numeric digits `digit { [ '_' ] digit }` of the charset as X3 rule. Note, the
+/// digits are unbounded, the digit parsers of the grammar are bounded by the
+/// @ref parse_limits, see @ref delimited_digits_parser.
+///
 static auto const delimit_numeric_digits = [](auto&& char_range, char const* name = "numeric digits" ) {
     auto const chars = x3::char_(char_range);
     // clang-format off
@@ -57,12 +74,6 @@ static auto const delimit_numeric_digits = [](auto&& char_range, char const* nam
         x3::raw[chars >> *('_' >> +chars | chars)];
     // clang-format on
 };
-#endif
-
-static auto const bin_digits = delimit_numeric_digits("01", "binary digits");
-static auto const oct_digits = delimit_numeric_digits("0-7", "octal digits");
-static auto const dec_digits = delimit_numeric_digits("0-9", "decimal digits");
-static auto const hex_digits = delimit_numeric_digits("0-9a-fA-F", "hexadecimal digits");
 
 ///
 /// create charsets by any given base in range [2...36]
@@ -91,6 +102,238 @@ auto const based_charset = [](unsigned base) {
     return ranges::to<std::string>(char_list | views::join);
 };
 
+namespace detail {
+
+///
+/// Scan delimited digits `digit { [ '_' ] digit }` of the compile time base, the charset
+/// check is folded into a compare of the @ref convert::detail::chr2dec table's value.
+///
+/// @return The iterator behind the digits, which is `first` if there is none.
+///
+template <unsigned Base, typename IteratorT>
+IteratorT scan_delimited_digits(IteratorT first, IteratorT const& last)
+{
+    static_assert(2U <= Base && Base <= 36U, "Base must be in range [2, 36]");
+
+    auto const is_digit = [](char chr) { return convert::detail::chr2dec(chr) < Base; };
+
+    if (first == last || !is_digit(*first)) {
+        return first;
+    }
+
+    auto iter = first;
+    ++iter;
+
+    while (iter != last) {
+        auto digit_iter = iter;
+        if (*digit_iter == '_') {
+            // delimiter must be followed by a digit
+            ++digit_iter;
+            if (digit_iter == last) {
+                break;
+            }
+        }
+        if (!is_digit(*digit_iter)) {
+            break;
+        }
+        iter = ++digit_iter;
+    }
+
+    return iter;
+}
+
+template <typename IteratorT>
+using scan_delimited_digits_fn = IteratorT (*)(IteratorT, IteratorT const&);
+
+template <typename IteratorT, std::size_t... Index>
+constexpr auto make_delimited_digits_scanners(std::index_sequence<Index...>)
+{
+    return std::array<scan_delimited_digits_fn<IteratorT>, sizeof...(Index)>{
+        &scan_delimited_digits<static_cast<unsigned>(Index) + 2U, IteratorT>...
+    };
+}
+
+///
+/// The scanners of all bases in range [2...36], indexed by `base - 2`.
+///
+template <typename IteratorT>
+static constexpr auto delimited_digits_scanners =
+    make_delimited_digits_scanners<IteratorT>(std::make_index_sequence<35>{});
+
+///
+/// Scan delimited digits of the base, on contiguous memory by the vectorized character
+/// class scanner, otherwise by the compile time specialized scanner of the base.
+///
+/// @return The iterator behind the digits, which is `first` if there is none.
+///
+template <typename IteratorT>
+IteratorT scan_based_digits(IteratorT const& first, IteratorT const& last, unsigned base)
+{
+    if constexpr (std::contiguous_iterator<IteratorT> &&
+                  std::is_same_v<std::iter_value_t<IteratorT>, char>) {
+        if (first == last) {
+            return first;
+        }
+        auto const* const ptr = std::to_address(first);
+        auto const* const ptr_end = ptr + std::distance(first, last);
+        return std::next(first, simd::scan_delimited_digits(ptr, ptr_end, base) - ptr);
+    }
+    else {
+        return delimited_digits_scanners<IteratorT>[base - 2U](first, last);
+    }
+}
+
+}  // namespace detail
+
+///
+/// Delimited numeric digits of the given base, the same as matched by
+/// @ref delimit_numeric_digits with the @ref based_charset. The digits are scanned
+/// vectorized, otherwise the base specific scanner is selected by table; there is neither
+/// a charset built nor a type erased parser used.
+///
+/// The digits are bounded by @ref parse_limits::max_digits(), exceeding digits fail
+/// with expectation failure.
+///
+struct delimited_digits_parser : x3::parser<delimited_digits_parser> {
+    using attribute_type = std::string;
+
+    explicit delimited_digits_parser(unsigned base_)
+        : base{ base_ }
+    {
+        assert(valid_base(base) && "Base must be in range [2, 36]");
+    }
+
+    template <typename IteratorT, typename ContextT, typename RContextT, typename AttributeT>
+    bool parse(IteratorT& first, IteratorT const& last, ContextT const& ctx,
+               [[maybe_unused]] RContextT const& rctx, AttributeT& attribute) const
+    {
+        // use lexeme[] from outer parser
+        x3::skip_over(first, last, ctx);
+
+        auto const max_digits = parse_limits::current().max_digits(base);
+
+        // scan beyond the limit to detect exceeding digits
+        auto const iter = detail::scan_based_digits(
+            first, ::parser::detail::bounded_digits_last(first, last, max_digits), base);
+
+        if (iter == first) {
+            return false;
+        }
+
+        if (auto const exceeding = ::parser::detail::exceeding_digit(first, iter, max_digits);
+            exceeding != iter) {
+            throw x3::expectation_failure<IteratorT>(
+                exceeding, parse_limits::exceeded(name(), max_digits, "digits"));
+        }
+
+        x3::traits::move_to(first, iter, attribute);
+        first = iter;
+
+        return true;
+    }
+
+    char const* name() const { return digits_name(base); }
+
+    unsigned const base;
+};
+
+inline auto delimited_digits(unsigned base)
+{
+    return delimited_digits_parser{ base };
+}
+
+static delimited_digits_parser const bin_digits{ 2 };
+static delimited_digits_parser const oct_digits{ 8 };
+static delimited_digits_parser const dec_digits{ 10 };
+static delimited_digits_parser const hex_digits{ 16 };
+
+///
+/// The value of delimited numeric digits, accumulated while they are parsed.
+///
+template <UnsignedIntegralType IntT>
+struct accumulated_digits {
+    IntT value = 0;
+    /// count of characters in front of the digit, which overflows the value, if any
+    std::optional<std::size_t> overflow_offset;
+};
+
+///
+/// Fused scan-and-convert of delimited numeric digits `digit { [ '_' ] digit }` to the
+/// base, the same as matched by @ref delimit_numeric_digits. The end of the digits is
+/// scanned vectorized, the value is accumulated over the scanned span; there is no
+/// intermediate string. An overflow of the value doesn't stop the parser, it's up to the
+/// caller to report it.
+///
+template <UnsignedIntegralType IntT>
+struct accumulate_digits_parser : x3::parser<accumulate_digits_parser<IntT>> {
+    using attribute_type = accumulated_digits<IntT>;
+
+    explicit accumulate_digits_parser(unsigned base_)
+        : base{ base_ }
+    {
+        assert(valid_base(base) && "Base must be in range [2, 36]");
+    }
+
+    template <typename IteratorT, typename ContextT, typename RContextT, typename AttributeT>
+    bool parse(IteratorT& first, IteratorT const& last, [[maybe_unused]] ContextT const& ctx,
+               [[maybe_unused]] RContextT const& rctx, AttributeT& attribute) const
+    {
+        // use lexeme[] from outer parser
+        IntT constexpr max = std::numeric_limits<IntT>::max();
+
+        auto const max_digits = parse_limits::current().max_digits(base);
+
+        // the end of the digits is scanned vectorized, see @ref delimited_digits_parser
+        auto const iter = detail::scan_based_digits(
+            first, ::parser::detail::bounded_digits_last(first, last, max_digits), base);
+
+        if (iter == first) {
+            return false;
+        }
+
+        if (auto const exceeding = ::parser::detail::exceeding_digit(first, iter, max_digits);
+            exceeding != iter) {
+            throw x3::expectation_failure<IteratorT>(
+                exceeding, parse_limits::exceeded(digits_name(base), max_digits, "digits"));
+        }
+
+        attribute_type result;
+        std::size_t offset = 0;
+
+        for (auto digit_iter = first; digit_iter != iter; ++digit_iter, ++offset) {
+            if (*digit_iter == '_') {
+                continue;
+            }
+
+            auto const digit = convert::detail::chr2dec(*digit_iter);
+            if (result.value > (max - digit) / base) {
+                if (!result.overflow_offset) {
+                    result.overflow_offset = offset;
+                }
+            }
+            else {
+                result.value = static_cast<IntT>(result.value * base + digit);
+            }
+        }
+
+        first = iter;
+
+        if constexpr (!std::is_same_v<AttributeT, x3::unused_type>) {
+            attribute = result;
+        }
+
+        return true;
+    }
+
+    unsigned const base;
+};
+
+template <UnsignedIntegralType IntT>
+inline auto accumulate_digits(unsigned base)
+{
+    return accumulate_digits_parser<IntT>{ base };
+}
+
 
 #if 0 // unused
 namespace detail {
@@ -168,3 +411,16 @@ requires BasicBaseRange<Base>  // --
 
 }  // namespace char_parser
 }  // namespace parser
+
+namespace boost::spirit::x3 {
+
+template <>
+struct get_info<::parser::char_parser::delimited_digits_parser> {
+    using result_type = std::string;
+    std::string operator()(::parser::char_parser::delimited_digits_parser const& parser) const
+    {
+        return parser.name();
+    }
+};
+
+}  // namespace boost::spirit::x3
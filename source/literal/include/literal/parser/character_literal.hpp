@@ -15,6 +15,16 @@ namespace parser {
 namespace x3 = boost::spirit::x3;
 
 // BNF: character_literal ::= ' graphic_character '
+namespace detail {
+
+// clang-format off
+static auto const character_literal_grammar = x3::lexeme [
+    "\'" >> x3::expect[( graphic_character - "\'" ) | x3::char_("\'")] >> "\'"
+];
+// clang-format on
+
+}  // namespace detail
+
 struct character_literal_parser : x3::parser<character_literal_parser> {
     using attribute_type = ast::character_literal;
 
@@ -24,11 +34,7 @@ struct character_literal_parser : x3::parser<character_literal_parser> {
     {
         skip_over(first, last, ctx);
 
-        auto const grammar = x3::lexeme [
-            "\'" >> x3::expect[( graphic_character - "\'" ) | x3::char_("\'")] >> "\'"
-        ];
-
-        auto const parse_ok = x3::parse(first, last, grammar, attribute);
+        auto const parse_ok = x3::parse(first, last, detail::character_literal_grammar, attribute);
 
         if (!parse_ok) {
             return false;
@@ -5,8 +5,15 @@
 
 #pragma once
 
+#include <literal/parser/util/simd_scan.hpp>
+
 #include <boost/spirit/home/x3.hpp>
 
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+
 namespace parser {
 
 namespace x3 = boost::spirit::x3;
@@ -15,4 +22,100 @@ static auto const c_style_comments = "/*" >> x3::lexeme[*(x3::char_ - "*/")] >>
 static auto const cpp_style_comment = "//" >> *~x3::char_("\r\n");
 static auto const comment = cpp_style_comment | c_style_comments;
 
+namespace detail {
+
+///
+/// Skip white space and comments of contiguous memory, the same as `x3::space | comment`.
+/// The white space runs, line ends and block comment ends are searched vectorized.
+///
+inline char const* skip_space_and_comments(char const* first, char const* last)
+{
+    for (;;) {
+        first = simd::find_not_space(first, last);
+
+        if (last - first < 2 || first[0] != '/') {
+            return first;
+        }
+
+        if (first[1] == '/') {
+            first = simd::find_line_end(first + 2, last);
+        }
+        else if (first[1] == '*') {
+            auto const* const comment_end = simd::find_pair(first + 2, last, '*', '/');
+            if (comment_end == last) {
+                // an unterminated comment isn't a comment
+                return first;
+            }
+            first = comment_end + 2;
+        }
+        else {
+            return first;
+        }
+    }
+}
+
+template <typename IteratorT>
+IteratorT skip_space_and_comments(IteratorT first, IteratorT const& last)
+{
+    if constexpr (std::contiguous_iterator<IteratorT> &&
+                  std::is_same_v<std::iter_value_t<IteratorT>, char>) {
+        if (first == last) {
+            return first;
+        }
+        auto const* const ptr = std::to_address(first);
+        auto const* const end = ptr + std::distance(first, last);
+        return std::next(first, skip_space_and_comments(ptr, end) - ptr);
+    }
+    else {
+        // character by character
+        for (;;) {
+            auto iter = first;
+            x3::parse(iter, last, *(x3::space | comment));
+            if (iter == first) {
+                return first;
+            }
+            first = iter;
+        }
+    }
+}
+
+}  // namespace detail
+
+///
+/// The skipper, usable in place of `x3::space | comment`.
+///
+struct skipper_parser : x3::parser<skipper_parser> {
+    using attribute_type = x3::unused_type;
+    static bool const has_attribute = false;
+
+    template <typename IteratorT, typename ContextT, typename RContextT, typename AttributeT>
+    bool parse(IteratorT& first, IteratorT const& last, [[maybe_unused]] ContextT const& ctx,
+               [[maybe_unused]] RContextT const& rctx, [[maybe_unused]] AttributeT& attr) const
+    {
+        auto const iter = detail::skip_space_and_comments(first, last);
+
+        if (iter == first) {
+            return false;
+        }
+
+        first = iter;
+        return true;
+    }
+};
+
+static skipper_parser const skipper = {};
+
 } // namespace parser
+
+namespace boost::spirit::x3 {
+
+template <>
+struct get_info<::parser::skipper_parser> {
+    using result_type = std::string;
+    std::string operator()([[maybe_unused]] ::parser::skipper_parser const&) const
+    {
+        return "white space or comment";
+    }
+};
+
+}  // namespace boost::spirit::x3
@@ -8,6 +8,7 @@
 #include <literal/ast.hpp>
 #include <literal/parser/char_parser.hpp>
 #include <literal/parser/error_handler.hpp>
+#include <literal/parser/util/scan_statistics.hpp>
 #include <literal/convert/leaf_error_handler.hpp>
 #include <literal/convert/convert.hpp>
 
@@ -21,7 +22,11 @@
 #include <range/v3/range/conversion.hpp>
 
 #include <cmath>
+#include <cstddef>
+#include <iterator>
 #include <limits>
+#include <string_view>
+#include <system_error>
 #include <iostream>
 
 namespace parser {
@@ -31,27 +36,190 @@ namespace leaf = boost::leaf;
 
 namespace detail {
 
-// clang-format off
-auto const exponent = [](auto&& signs) {
-    using char_parser::dec_digits;
-    using x3::char_;
-    using CharT = decltype(signs);
-    return x3::rule<struct exponent_class, std::string>{ "exponent" } = x3::as_parser(
-        x3::omit[ char_("Ee") ]
-        >> x3::raw[ x3::lexeme [
-             -char_(std::forward<CharT>(signs)) >> dec_digits
-        ]]
-    );
+///
+/// A scanned run of delimited digits `digit { [ '_' ] digit }`, the value is accumulated
+/// while scanning. The spelling may start in front of the digits, e.g. with the
+/// exponent's sign.
+///
+template <typename IteratorT>
+struct digit_run {
+    IteratorT first;
+    IteratorT digits_first;
+    IteratorT last;
+    char_parser::accumulated_digits<ast::integer_type::value_type> digits;
+
+    bool empty() const { return first == last; }
 };
-// clang-format on
 
-// clang-format off
-auto const signed_exp = x3::rule<struct _, std::string>{ "real exponent" } =
-    exponent("-+");
+///
+/// Scan the delimited digits of the base, the iterator is advanced only on success.
+///
+template <typename IteratorT>
+bool scan_digit_run(IteratorT& iter, IteratorT const& last, unsigned base,
+                    digit_run<IteratorT>& run)
+{
+    using value_type = ast::integer_type::value_type;
+
+    auto scan_iter = iter;
+    if (!x3::parse(scan_iter, last, char_parser::accumulate_digits<value_type>(base), run.digits)) {
+        return false;
+    }
+
+    scan_statistics::count_inspected(std::distance(iter, scan_iter) + 1);
+
+    run.first = run.digits_first = iter;
+    run.last = iter = scan_iter;
+    return true;
+}
+
+///
+/// Scan the optional exponent `E [ sign ] integer`, where the signs are those allowed.
+/// The run's spelling is the signed integer as matched by @ref exponent.
+///
+template <typename IteratorT>
+bool scan_exponent(IteratorT& iter, IteratorT const& last, std::string_view signs,
+                   digit_run<IteratorT>& exponent)
+{
+    exponent.first = exponent.digits_first = exponent.last = iter;
+
+    scan_statistics::count_inspected(1);
+    if (iter == last || (*iter != 'E' && *iter != 'e')) {
+        return false;
+    }
+
+    auto exp_iter = std::next(iter);
+    auto const sign_first = exp_iter;
+
+    scan_statistics::count_inspected(1);
+    if (exp_iter != last && signs.find(*exp_iter) != std::string_view::npos) {
+        ++exp_iter;
+    }
+
+    if (!scan_digit_run(exp_iter, last, 10U, exponent)) {
+        exponent.first = exponent.digits_first = exponent.last = iter;
+        return false;
+    }
+
+    exponent.first = sign_first;
+    iter = exp_iter;
+    return true;
+}
+
+///
+/// Scan the integer literal `digits separator [ E [+] digits ]` of the base, where the
+/// separator is e.g. the closing '#' of a based literal. The spelling is available by the
+/// digit runs, there are no strings built before the literal has been matched.
+///
+template <typename IteratorT, typename SeparatorT>
+bool scan_integer_literal(IteratorT& first, IteratorT const& last, unsigned base,
+                          SeparatorT const& separator, digit_run<IteratorT>& integer,
+                          digit_run<IteratorT>& exponent)
+{
+    auto iter = first;
+
+    if (!scan_digit_run(iter, last, base, integer) || !x3::parse(iter, last, separator)) {
+        return false;
+    }
+
+    scan_exponent(iter, last, "+", exponent);
+
+    first = iter;
+    return true;
+}
+
+///
+/// Scan the real literal `digits . digits separator [ E [-+] digits ]` of the base, see
+/// @ref scan_integer_literal.
+///
+/// @throws x3::expectation_failure if the fractional digits are missing.
+///
+template <typename IteratorT, typename SeparatorT>
+bool scan_real_literal(IteratorT& first, IteratorT const& last, unsigned base,
+                       SeparatorT const& separator, digit_run<IteratorT>& integer,
+                       digit_run<IteratorT>& fractional, digit_run<IteratorT>& exponent)
+{
+    auto iter = first;
+
+    if (!scan_digit_run(iter, last, base, integer) || iter == last || *iter != '.') {
+        return false;
+    }
+    ++iter;
+
+    if (!scan_digit_run(iter, last, base, fractional)) {
+        throw x3::expectation_failure<IteratorT>(iter,
+                                                 x3::what(char_parser::delimited_digits(base)));
+    }
+
+    if (!x3::parse(iter, last, separator)) {
+        return false;
+    }
+
+    scan_exponent(iter, last, "-+", exponent);
+
+    first = iter;
+    return true;
+}
+
+///
+/// The value of an integer literal from the accumulated digits of the integer and the
+/// (optional) exponent.
+///
+/// @throws leaf::exception with `std::errc::result_out_of_range`, pointing to the
+/// overflowing digit, or from the scaling by the exponent.
+///
+template <typename IteratorT>
+ast::integer_type::value_type fused_integer_value(unsigned base,
+                                                  digit_run<IteratorT> const& integer,
+                                                  digit_run<IteratorT> const& exponent)
+{
+    LEAF_ERROR_TRACE;
+
+    for (auto const* run : { &integer, &exponent }) {
+        if (run->digits.overflow_offset) {
+            throw leaf::exception(std::make_error_code(std::errc::result_out_of_range),
+                                  leaf::e_api_function{ "fused_integer_value" },
+                                  leaf::e_position_iterator{ std::next(
+                                      run->digits_first,
+                                      static_cast<std::ptrdiff_t>(*run->digits.overflow_offset)) });
+        }
+    }
 
-auto const unsigned_exp = x3::rule<struct _, std::string>{ "integer exponent" } =
-    exponent('+');
-// clang-format on
+    if (exponent.empty()) {
+        return integer.digits.value;
+    }
+
+    // LEAF - power() or range overflow
+    return convert::detail::scale_integer(integer.digits.value, base, exponent.digits.value);
+}
+
+#if defined(USE_FUSED_PARSER_CONVERT)
+///
+/// Fused scan-and-convert of an integer literal `digits separator [ E [+] digits ]`.
+/// The digits are converted while they are parsed, the literal's strings are assigned
+/// from the matched character ranges only.
+///
+/// @throws leaf::exception, @see fused_integer_value()
+///
+template <typename IteratorT, typename SeparatorT>
+bool parse_fused_integer(IteratorT& first, IteratorT const& last, unsigned base,
+                         SeparatorT const& separator, ast::integer_type& attribute)
+{
+    LEAF_ERROR_TRACE;
+
+    digit_run<IteratorT> integer;
+    digit_run<IteratorT> exponent;
+    if (!scan_integer_literal(first, last, base, separator, integer, exponent)) {
+        return false;
+    }
+
+    attribute.integer.assign(integer.first, integer.last);
+    attribute.exponent.assign(exponent.first, exponent.last);
+
+    // LEAF
+    attribute.value = fused_integer_value(base, integer, exponent);
+    return true;
+}
+#endif  // USE_FUSED_PARSER_CONVERT
 
 // BNF: decimal_literal := integer [ . integer ] [ exponent ]
 struct decimal_integer_parser : x3::parser<decimal_integer_parser> {
@@ -65,20 +233,31 @@ struct decimal_integer_parser : x3::parser<decimal_integer_parser> {
 
         skip_over(first, last, ctx);
 
-        using char_parser::dec_digits;
-        using detail::unsigned_exp;
-        using x3::lit;
+#if defined(USE_FUSED_PARSER_CONVERT)
+        auto const begin = first;
+        attribute.base = 10U;  // decimal literal is always to the base of 10
 
-        auto const grammar =  // use lexeme[] from outer parser; exclude based literal
-            dec_digits >> !lit('#') >> -unsigned_exp;
+        return leaf::try_catch(
+            [&] {
+                auto load = leaf::on_error(leaf::e_x3_parser_context{*this, first, begin});
 
-        auto const parse_ok = x3::parse(first, last, grammar, attribute);
+                // LEAF - overflow, or power() may fail; exclude based literal
+                return parse_fused_integer(first, last, attribute.base, !x3::lit('#'), attribute);
+            },
+            convert::leaf_error_handlers<IteratorT>);
+#else
+        [[maybe_unused]] auto const begin = first;
 
-        if (!parse_ok) {
+        // exclude based literal
+        digit_run<IteratorT> integer;
+        digit_run<IteratorT> exponent;
+        if (!scan_integer_literal(first, last, 10U, !x3::lit('#'), integer, exponent)) {
             return false;
         }
 
         attribute.base = 10U;  // decimal literal is always to the base of 10
+        attribute.integer.assign(integer.first, integer.last);
+        attribute.exponent.assign(exponent.first, exponent.last);
 
 #if defined(USE_IN_PARSER_CONVERT)
         return leaf::try_catch(
@@ -93,6 +272,7 @@ struct decimal_integer_parser : x3::parser<decimal_integer_parser> {
 #else
         return true;
 #endif
+#endif  // USE_FUSED_PARSER_CONVERT
     }
 };
 
@@ -110,19 +290,19 @@ struct decimal_real_parser : x3::parser<decimal_real_parser> {
 
         skip_over(first, last, ctx);
 
-        using char_parser::dec_digits;
-        using detail::signed_exp;
-
-        auto const grammar =  // use lexeme[] from outer parser
-            dec_digits >> '.' >> x3::expect[dec_digits] >> -signed_exp;
-
-        auto const parse_ok = x3::parse(first, last, grammar, attribute);
+        [[maybe_unused]] auto const begin = first;
 
-        if (!parse_ok) {
+        digit_run<IteratorT> integer;
+        digit_run<IteratorT> fractional;
+        digit_run<IteratorT> exponent;
+        if (!scan_real_literal(first, last, 10U, x3::eps, integer, fractional, exponent)) {
             return false;
         }
 
         attribute.base = 10U;  // decimal literal has always base = 10
+        attribute.integer.assign(integer.first, integer.last);
+        attribute.fractional.assign(fractional.first, fractional.last);
+        attribute.exponent.assign(exponent.first, exponent.last);
 
 #if defined(USE_IN_PARSER_CONVERT)
         return leaf::try_catch(
@@ -142,6 +322,8 @@ struct decimal_real_parser : x3::parser<decimal_real_parser> {
 
 static decimal_real_parser const decimal_real = {};
 
+static auto const decimal_literal_grammar = x3::lexeme[(decimal_real | decimal_integer)];
+
 }  // namespace detail
 
 // BNF: decimal_literal := integer [ . integer ] [ exponent ]
@@ -154,12 +336,7 @@ struct decimal_literal_parser : x3::parser<decimal_literal_parser> {
     {
         skip_over(first, last, ctx);
 
-        using detail::decimal_integer;
-        using detail::decimal_real;
-
-        auto const grammar = x3::lexeme[(decimal_real | decimal_integer)];
-
-        auto const parse_ok = x3::parse(first, last, grammar, attribute);
+        auto const parse_ok = x3::parse(first, last, detail::decimal_literal_grammar, attribute);
 
         if (!parse_ok) {
             return false;
@@ -116,7 +116,8 @@ auto error_recovery(It& first, It last, Ctx const& ctx) {
     return detail::error_recovery_strategy<RuleID>{}(first, last, ctx);
 }
 
-static unsigned error_count = 0;
+// one counter of the program, the error handler is instantiated in several translation units
+inline unsigned error_count = 0;
 
 ///
 /// Customizable parser error handler to use different error recovery strategies.
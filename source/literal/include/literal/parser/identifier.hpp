@@ -5,72 +5,449 @@
 
 #pragma once
 
+#include <literal/ast.hpp>
+#include <literal/parser/parse_limits.hpp>
+#include <literal/parser/util/simd_scan.hpp>
+
 #include <boost/spirit/home/x3.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
 #include <iostream>
 
 namespace parser {
 
 namespace x3 = boost::spirit::x3;
 
+///
+/// The id of a keyword, the index into @ref keyword_names plus one; @ref no_keyword for
+/// an identifier.
+///
+using keyword_id = std::uint8_t;
+
+static constexpr keyword_id no_keyword = 0;
+
+// clang-format off
+static constexpr std::array<std::string_view, 97> keyword_names = {
+    "abs", "access", "after", "alias", "all", "and", "architecture",
+    "array", "assert", "attribute", "begin", "block", "body", "buffer",
+    "bus", "case", "component", "configuration", "constant", "disconnect",
+    "downto", "else", "elsif", "end", "entity", "exit", "file", "for",
+    "function", "generate", "generic", "group", "guarded", "if", "impure",
+    "in", "inertial", "inout", "is", "label",  "library", "linkage",
+    "literal", "loop", "map", "mod", "nand", "new", "next", "nor", "not",
+    "null", "of", "on",  "open", "or", "others", "out", "package", "port",
+    "postponed", "procedure", "process", "pure", "range", "record",
+    "register", "reject", "rem", "report", "return", "rol", "ror",
+    "select", "severity", "signal", "shared", "sla", "sll", "sra", "srl",
+    "subtype", "then", "to", "transport", "type", "unaffected", "units",
+    "until", "use", "variable", "wait", "when", "while", "with", "xnor",
+    "xor"
+};
+// clang-format on
+
+static constexpr std::size_t max_keyword_length = [] {
+    std::size_t length = 0;
+    for (auto const keyword : keyword_names) {
+        length = keyword.size() > length ? keyword.size() : length;
+    }
+    return length;
+}();
+
+namespace detail {
+
+constexpr char to_lower(char chr)
+{
+    return ('A' <= chr && chr <= 'Z') ? static_cast<char>(chr - 'A' + 'a') : chr;
+}
+
+///
+/// Case insensitive FNV-1a hashes of a word, computed in one pass: the first selects the
+/// bucket, the second the slot by the bucket's displacement.
+///
+struct keyword_hash {
+    static constexpr std::uint32_t prime = 16777619U;
+
+    std::uint32_t bucket_hash = 2166136261U;
+    std::uint32_t slot_hash = 0x811C9DC5U ^ 0x5BD1E995U;
+
+    constexpr void update(char chr)
+    {
+        auto const lower = static_cast<std::uint8_t>(to_lower(chr));
+        bucket_hash = (bucket_hash ^ lower) * prime;
+        slot_hash = (slot_hash ^ lower) * prime;
+    }
+};
+
+///
+/// Compile time perfect hash of the keywords by hash and displacement (CHD): each bucket
+/// of keywords gets a displacement, which maps all of them into distinct, free slots.
+///
+struct keyword_table {
+    static constexpr std::size_t bucket_count = 64;
+    static constexpr unsigned slot_bits = 8;
+    static constexpr std::size_t slot_count = std::size_t{ 1 } << slot_bits;
+
+    static_assert(keyword_names.size() < slot_count);
+
+    std::array<std::uint16_t, bucket_count> displacement{};
+    std::array<keyword_id, slot_count> slot_keyword{};  // no_keyword
+
+    static constexpr std::size_t bucket_of(keyword_hash const& hash)
+    {
+        return hash.bucket_hash % bucket_count;
+    }
+
+    static constexpr std::size_t slot_of(keyword_hash const& hash, std::uint16_t displacement)
+    {
+        // multiplicative mixing, otherwise the displacement wouldn't change the collisions
+        return ((hash.slot_hash ^ displacement) * 2654435761U) >> (32U - slot_bits);
+    }
+};
+
+constexpr keyword_hash hash_of(std::string_view word)
+{
+    keyword_hash hash;
+    for (char const chr : word) {
+        hash.update(chr);
+    }
+    return hash;
+}
+
+constexpr keyword_table make_keyword_table()
+{
+    constexpr auto keyword_count = keyword_names.size();
+    constexpr auto bucket_count = keyword_table::bucket_count;
+
+    std::array<std::array<std::size_t, keyword_count>, bucket_count> buckets{};
+    std::array<std::size_t, bucket_count> bucket_size{};
+
+    for (std::size_t i = 0; i != keyword_count; ++i) {
+        auto const bucket = keyword_table::bucket_of(hash_of(keyword_names[i]));
+        buckets[bucket][bucket_size[bucket]++] = i;
+    }
+
+    // place the largest buckets first
+    std::array<std::size_t, bucket_count> order{};
+    for (std::size_t i = 0; i != bucket_count; ++i) {
+        order[i] = i;
+    }
+    for (std::size_t i = 1; i < bucket_count; ++i) {
+        for (std::size_t j = i; j != 0 && bucket_size[order[j - 1]] < bucket_size[order[j]]; --j) {
+            auto const tmp = order[j];
+            order[j] = order[j - 1];
+            order[j - 1] = tmp;
+        }
+    }
+
+    keyword_table table;
+
+    for (auto const bucket : order) {
+        auto const size = bucket_size[bucket];
+        if (size == 0) {
+            break;
+        }
+
+        bool placed = false;
+        for (std::uint32_t displacement = 0; !placed && displacement != 0x10000; ++displacement) {
+            std::array<std::size_t, keyword_count> slots{};
+            placed = true;
+            for (std::size_t i = 0; placed && i != size; ++i) {
+                auto const slot = keyword_table::slot_of(hash_of(keyword_names[buckets[bucket][i]]),
+                                                         static_cast<std::uint16_t>(displacement));
+                placed = table.slot_keyword[slot] == no_keyword;
+                for (std::size_t j = 0; placed && j != i; ++j) {
+                    placed = slots[j] != slot;
+                }
+                slots[i] = slot;
+            }
+            if (placed) {
+                table.displacement[bucket] = static_cast<std::uint16_t>(displacement);
+                for (std::size_t i = 0; i != size; ++i) {
+                    table.slot_keyword[slots[i]] = static_cast<keyword_id>(buckets[bucket][i] + 1);
+                }
+            }
+        }
+
+        if (!placed) {
+            throw std::logic_error("no perfect hash of the keywords");
+        }
+    }
+
+    return table;
+}
+
+static constexpr auto keyword_perfect_hash = make_keyword_table();
+
+}  // namespace detail
+
+///
+/// Case insensitive lookup of the word, of which the hash has been computed while scanning.
+///
+template <typename IteratorT>
+constexpr keyword_id lookup_keyword(IteratorT first, IteratorT const& last,
+                                    detail::keyword_hash const& hash)
+{
+    using detail::keyword_table;
+
+    auto const& table = detail::keyword_perfect_hash;
+    auto const displacement = table.displacement[keyword_table::bucket_of(hash)];
+    auto const id = table.slot_keyword[keyword_table::slot_of(hash, displacement)];
+
+    if (id == no_keyword) {
+        return no_keyword;
+    }
+
+    auto const keyword = keyword_names[id - 1U];
+    for (char const chr : keyword) {
+        if (first == last || detail::to_lower(*first) != chr) {
+            return no_keyword;
+        }
+        ++first;
+    }
+    return first == last ? id : no_keyword;
+}
+
+template <typename IteratorT>
+constexpr keyword_id lookup_keyword(IteratorT first, IteratorT const& last)
+{
+    detail::keyword_hash hash;
+    std::size_t length = 0;
+    for (auto iter = first; iter != last; ++iter) {
+        if (++length > max_keyword_length) {
+            return no_keyword;  // a long identifier isn't hashed
+        }
+        hash.update(*iter);
+    }
+    return lookup_keyword(first, last, hash);
+}
+
+constexpr keyword_id lookup_keyword(std::string_view word)
+{
+    return lookup_keyword(word.begin(), word.end());
+}
+
+static constexpr keyword_id null_keyword = lookup_keyword("null");
+
+static_assert(null_keyword != no_keyword && keyword_names[null_keyword - 1U] == "null");
+
 namespace detail {
 
-struct distinct_directive {
+///
+/// The identifier's end and its keyword id, if any.
+///
+template <typename IteratorT>
+struct scanned_word {
+    IteratorT last;
+    keyword_id keyword = no_keyword;
+};
+
+///
+/// Scan the word characters `{ letter_or_digit | '_' }`, on contiguous memory vectorized.
+///
+/// @return The iterator behind the word characters.
+///
+template <typename IteratorT>
+IteratorT scan_word_chars(IteratorT const& first, IteratorT const& last)
+{
+    static constexpr unsigned word_radix = 36;  // [0-9a-zA-Z_]
+
+    if constexpr (std::contiguous_iterator<IteratorT> &&
+                  std::is_same_v<std::iter_value_t<IteratorT>, char>) {
+        if (first == last) {
+            return first;
+        }
+        auto const* const ptr = std::to_address(first);
+        auto const* const ptr_end = ptr + std::distance(first, last);
+        return std::next(first, simd::find_not_alnum_or_underline(ptr, ptr_end, word_radix) - ptr);
+    }
+    else {
+        auto iter = first;
+        while (iter != last && simd::detail::is_alnum_or_underline(*iter, word_radix)) {
+            ++iter;
+        }
+        return iter;
+    }
+}
+
+///
+/// Scan the word `letter { letter_or_digit | '_' }`, which is looked up as keyword
+/// by its hash, see @ref lookup_keyword. A letter followed by '"' isn't a word, but
+/// the base specifier of a bit string literal.
+///
+/// The keyword must be distinct, i.e. not followed by a (ISO-8859-1) letter or digit,
+/// otherwise the word is an identifier.
+///
+/// @throws x3::expectation_failure if the word exceeds the identifier length of the
+/// @ref parse_limits.
+///
+template <typename IteratorT>
+bool scan_word(IteratorT const& first, IteratorT const& last, scanned_word<IteratorT>& word)
+{
+    using boost::spirit::char_encoding::iso8859_1;
+    using boost::spirit::char_encoding::standard;
+
+    auto const uchar = [](char chr) { return static_cast<unsigned char>(chr); };
+
+    if (first == last || !standard::isalpha(uchar(*first))) {
+        return false;
+    }
+
+    auto iter = std::next(first);
+    if (iter != last && *iter == '"') {
+        // reject bit_string_literal
+        return false;
+    }
+
+    auto const max_length = parse_limits::current().max_identifier_length;
+    auto const bound = bounded_last(first, last, max_length + 1);
+
+    iter = scan_word_chars(iter, bound);
+
+    if (static_cast<std::size_t>(std::distance(first, iter)) > max_length) {
+        throw x3::expectation_failure<IteratorT>(
+            std::next(first, static_cast<std::ptrdiff_t>(max_length)),
+            parse_limits::exceeded("identifier", max_length));
+    }
+
+    word.last = iter;
+    word.keyword = lookup_keyword(first, iter);
+
+    if (word.keyword != no_keyword && iter != last &&
+        iso8859_1::isalnum(uchar(*iter))) {
+        word.keyword = no_keyword;
+    }
+
+    return true;
+}
+
+}  // namespace detail
+
+// BNF: basic_identifier ::= letter { [ underline ] letter_or_digit }
+// Note: the identifier isn't restricted to the BNF, e.g. trailing and double underlines
+// are accepted.
+struct identifier_parser : x3::parser<identifier_parser> {
+    using attribute_type = ast::identifier;
+
+    template <typename IteratorT, typename ContextT, typename RContextT, typename AttributeT>
+    bool parse(IteratorT& first, IteratorT const& last, ContextT const& ctx,
+               [[maybe_unused]] RContextT const& rctx, AttributeT& attribute) const
+    {
+        x3::skip_over(first, last, ctx);
+
+        detail::scanned_word<IteratorT> word;
+        if (!detail::scan_word(first, last, word) || word.keyword != no_keyword) {
+            return false;
+        }
+
+        ast::identifier identifier;
+        identifier.name.assign(first, word.last);
+        x3::traits::move_to(identifier, attribute);
+        first = word.last;
 
-    template <typename Parser>
-    constexpr auto operator()(Parser&& parser) const {
-        return x3::lexeme[
-            x3::no_case[ std::forward<Parser>(parser) ] >> !(x3::iso8859_1::alnum | '_')
-        ];
+        return true;
+    }
+};
+
+///
+/// The distinct keyword, case insensitive.
+///
+struct keyword_parser : x3::parser<keyword_parser> {
+    using attribute_type = x3::unused_type;
+    static bool const has_attribute = false;
+
+    explicit constexpr keyword_parser(keyword_id id_)
+        : id{ id_ }
+    {
     }
+
+    template <typename IteratorT, typename ContextT, typename RContextT, typename AttributeT>
+    bool parse(IteratorT& first, IteratorT const& last, ContextT const& ctx,
+               [[maybe_unused]] RContextT const& rctx, [[maybe_unused]] AttributeT&) const
+    {
+        x3::skip_over(first, last, ctx);
+
+        detail::scanned_word<IteratorT> word;
+        if (!detail::scan_word(first, last, word) || word.keyword != id) {
+            return false;
+        }
+
+        first = word.last;
+        return true;
+    }
+
+    keyword_id const id;
 };
 
-static const distinct_directive distinct = {};
+///
+/// The keyword NULL or an identifier by one scan and keyword lookup, the same as the
+/// ordered choice `NULL_ | identifier` into the literal.
+///
+struct null_or_identifier_parser : x3::parser<null_or_identifier_parser> {
+    using attribute_type = ast::literal;
 
-static x3::symbols<> const keywords(
-    // clang-format off
+    template <typename IteratorT, typename ContextT, typename RContextT>
+    bool parse(IteratorT& first, IteratorT const& last, ContextT const& ctx,
+               [[maybe_unused]] RContextT const& rctx, attribute_type& attribute) const
     {
-        "abs", "access", "after", "alias", "all", "and", "architecture",
-        "array", "assert", "attribute", "begin", "block", "body", "buffer",
-        "bus", "case", "component", "configuration", "constant", "disconnect",
-        "downto", "else", "elsif", "end", "entity", "exit", "file", "for",
-        "function", "generate", "generic", "group", "guarded", "if", "impure",
-        "in", "inertial", "inout", "is", "label",  "library", "linkage",
-        "literal", "loop", "map", "mod", "nand", "new", "next", "nor", "not",
-        "null", "of", "on",  "open", "or", "others", "out", "package", "port",
-        "postponed", "procedure", "process", "pure", "range", "record",
-        "register", "reject", "rem", "report", "return", "rol", "ror",
-        "select", "severity", "signal", "shared", "sla", "sll", "sra", "srl",
-        "subtype", "then", "to", "transport", "type", "unaffected", "units",
-        "until", "use", "variable", "wait", "when", "while", "with", "xnor",
-        "xor"
-    },
-    "keyword"
-    // clang-format on
-);
-
-static auto const keyword = distinct(keywords);
-
-static auto const feasible_identifier =
-    // clang-format off
-    x3::raw[ x3::lexeme [
-           x3::alpha
-        >> !x3::char_('"') // reject bit_string_literal
-        >> *( x3::alnum | '_' )
-    ]];
-    // clang-format on
-
-
-static auto const basic_identifier = x3::rule<struct _, ast::identifier> { "basic identifier" } =
-    feasible_identifier - keyword;
-
-} // end detail
-
-static auto const identifier = detail::basic_identifier;
+        x3::skip_over(first, last, ctx);
+
+        detail::scanned_word<IteratorT> word;
+        if (!detail::scan_word(first, last, word)) {
+            return false;
+        }
+
+        if (word.keyword == null_keyword) {
+            // same as `x3::attr("kw:NULL")` of NULL_, which assigns the whole char array,
+            // including the terminating null character
+            static constexpr char null_name[] = "kw:NULL";
+            ast::identifier null;
+            null.name.assign(std::begin(null_name), std::end(null_name));
+            attribute = std::move(null);
+        }
+        else if (word.keyword == no_keyword) {
+            ast::identifier identifier;
+            identifier.name.assign(first, word.last);
+            attribute = ast::enumeration_literal{ std::move(identifier) };
+        }
+        else {
+            return false;
+        }
+
+        first = word.last;
+        return true;
+    }
+};
+
+static auto const identifier = x3::rule<struct _, ast::identifier> { "basic identifier" } =
+    identifier_parser{};
 
 static auto const primary_unit_name = identifier;
 
 // simplify keyword handling, no extra AST node
-static auto const NULL_ = x3::rule<struct _, ast::identifier> { "NULL" } = detail::distinct("null") >> x3::attr("kw:NULL");
+static auto const NULL_ = x3::rule<struct _, ast::identifier> { "NULL" } =
+    x3::lexeme[ keyword_parser{ null_keyword } ] >> x3::attr("kw:NULL");
+
+static null_or_identifier_parser const null_or_identifier = {};
 
 } // namespace parser
+
+namespace boost::spirit::x3 {
+
+template <>
+struct get_info<::parser::null_or_identifier_parser> {
+    using result_type = std::string;
+    std::string operator()([[maybe_unused]] ::parser::null_or_identifier_parser const&) const
+    {
+        return "NULL or identifier";
+    }
+};
+
+}  // namespace boost::spirit::x3
@@ -12,9 +12,13 @@
 #include <literal/parser/based_literal.hpp>
 #include <literal/parser/identifier.hpp>
 #include <literal/parser/string_literal.hpp>
+#include <literal/parser/numeric_literal.hpp>
+#include <literal/parser/literal_dispatch.hpp>
 #include <literal/parser/comment.hpp>
 #include <literal/parser/error_handler.hpp>
 #include <literal/parser/parser_id.hpp>
+#include <literal/parser/parse_limits.hpp>
+#include <literal/parser/util/packrat.hpp>
 
 #include <boost/spirit/home/x3.hpp>
 
@@ -29,14 +33,22 @@ namespace parser {
 
 // BNF: abstract_literal ::= decimal_literal | based_literal
 // Note: {decimal, based}_literal's AST nodes does have same memory layout!
+#if defined(USE_PARSER_PACKRAT)
+// memoized, since the alternatives are re-tried at the same position by the ordered
+// choice `physical_literal | abstract_literal` below
+auto const abstract_literal = x3::rule<struct abstract_literal_class, ast::abstract_literal>{ "based or decimal abstract literal" } =
+    memoize[based_literal] | memoize[decimal_literal]
+    ;
+#else
 auto const abstract_literal = x3::rule<struct abstract_literal_class, ast::abstract_literal>{ "based or decimal abstract literal" } =
     based_literal | decimal_literal
     ;
+#endif
 
 // Note, the LRM doesn't specify the allowed characters, hence it's assumed
 // that it follows the natural conventions.
 auto const unit_name = x3::rule<struct unit_name_class, std::string>{ "unit name" } =
-    x3::lexeme[ +x3::alpha ]
+    bounded_unit_name
     ;
 
 // BNF: physical_literal ::= [ abstract_literal ] unit_name
@@ -44,14 +56,33 @@ auto const unit_name = x3::rule<struct unit_name_class, std::string>{ "unit name
 // unit_name, with a default-constructed abstract_literal or more concrete based_literal
 // (and with base = 0) and an arbitrary unit_name - depending on the following lexemes.
 // This must be taken into account when implementing the secondary_unit_declaration!
+#if defined(USE_PARSER_PACKRAT)
+auto const physical_literal = x3::rule<struct physical_literal_class, ast::physical_literal>{ "physical literal" } =
+    memoize[abstract_literal] >> unit_name;
+    ;
+#else
 auto const physical_literal = x3::rule<struct physical_literal_class, ast::physical_literal>{ "physical literal" } =
     abstract_literal >> unit_name;
     ;
+#endif
 
 // BNF: numeric_literal ::= abstract_literal | physical_literal
+#if defined(USE_X3_NUMERIC_LITERAL)
+#if defined(USE_PARSER_PACKRAT)
+auto const numeric_literal = x3::rule<struct numeric_literal_class, ast::numeric_literal>{ "numeric literal" } =
+    physical_literal | memoize[abstract_literal] // order matters
+    ;
+#else
 auto const numeric_literal = x3::rule<struct numeric_literal_class, ast::numeric_literal>{ "numeric literal" } =
     physical_literal | abstract_literal // order matters
     ;
+#endif
+#else
+// single pass, without re-scanning of the alternatives above
+auto const numeric_literal = x3::rule<struct numeric_literal_class, ast::numeric_literal>{ "numeric literal" } =
+    single_pass_numeric_literal
+    ;
+#endif
 
 // BNF: character_literal ::= ' graphic_character '
 auto const character_literal = x3::rule<character_literal_class, ast::character_literal>{ "character literal" } =
@@ -64,16 +95,35 @@ auto const enumeration_literal = x3::rule<struct enumeration_literal_class, ast:
     ;
 
 // BNF: literal ::= numeric_literal | enumeration_literal | string_literal | bit_string_literal | null
-auto const literal = x3::rule<struct literal_class, ast::literal>{ "literal" } = // order matters
-    NULL_ | enumeration_literal | string_literal | bit_string_literal | numeric_literal
+// The literal alternative is selected by the first character, only the alternatives
+// starting with a letter are an ordered choice:
+//   NULL_ | enumeration_literal | string_literal | bit_string_literal | numeric_literal
+// where NULL and the identifier are recognized by one scan and keyword lookup.
+auto const string_literal_alternative = x3::rule<struct string_literal_alternative_class, ast::string_literal>{ "string literal" } =
+    string_literal
     ;
 
+auto const literal = x3::rule<struct literal_class, ast::literal>{ "literal" } =
+    literal_dispatch(
+        numeric_literal,
+        string_literal_alternative,
+        enumeration_literal,
+        null_or_identifier | bit_string_literal  // order matters
+    );
+
+#if defined(USE_PARSER_PACKRAT)
+// the memoized results are valid per statement
+auto const literal_rule = x3::rule<literal_rule_class, ast::literal>{ "literal" } =
+    packrat_scope[ statement_limit[ x3::lit("X") > ":=" > literal > ';' ] ]
+    ;
+#else
 auto const literal_rule = x3::rule<literal_rule_class, ast::literal>{ "literal" } =
-    x3::lit("X") > ":=" > literal > ';'
+    statement_limit[ x3::lit("X") > ":=" > literal > ';' ]
     ;
+#endif
 
 auto const grammar = x3::rule<grammar_class, ast::literals>{ "grammar" } =
-    x3::skip(x3::space | comment)[
+    x3::skip(skipper)[
         *literal_rule
     ];
 
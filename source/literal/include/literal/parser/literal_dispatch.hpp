@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <literal/ast.hpp>
+
+#include <boost/spirit/home/x3.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace parser {
+
+namespace x3 = boost::spirit::x3;
+
+///
+/// The lexical class of the first character of a literal, which determines the only
+/// plausible alternative(s) of the literal.
+///
+enum class first_char_class : std::uint8_t {
+    none,        ///< no literal starts with
+    digit,       ///< numeric literal: decimal, based or physical
+    quotation,   ///< string literal, delimited by '"' or '%'
+    apostrophe,  ///< character literal
+    letter,      ///< NULL, identifier or bit string literal
+    COUNT
+};
+
+namespace detail {
+
+constexpr std::array<first_char_class, 256> make_first_char_table()
+{
+    std::array<first_char_class, 256> table{};  // first_char_class::none
+
+    for (unsigned chr = '0'; chr <= '9'; ++chr) {
+        table[chr] = first_char_class::digit;
+    }
+    for (unsigned chr = 'a'; chr <= 'z'; ++chr) {
+        table[chr] = first_char_class::letter;
+        table[chr - 'a' + 'A'] = first_char_class::letter;
+    }
+    table['"'] = first_char_class::quotation;
+    table['%'] = first_char_class::quotation;
+    table['\''] = first_char_class::apostrophe;
+
+    return table;
+}
+
+}  // namespace detail
+
+///
+/// Lookup table of the literal's first (non-skipped) character.
+///
+static constexpr auto first_char_table = detail::make_first_char_table();
+
+///
+/// Counter of the dispatched literals, counted only if `USE_PARSER_STATISTICS` is defined.
+///
+/// The avoided alternatives are those, which would have been tried and rejected
+/// (with backtracking) by the ordered choice `NULL | enumeration_literal | string_literal |
+/// bit_string_literal | numeric_literal` before the alternative in question.
+///
+struct dispatch_statistics {
+    static constexpr auto CLASS_COUNT = static_cast<std::size_t>(first_char_class::COUNT);
+
+    std::array<std::atomic<std::size_t>, CLASS_COUNT> dispatched{};
+    std::atomic<std::size_t> avoided_alternatives = 0;
+
+    void count(first_char_class char_class)
+    {
+        static constexpr std::array<std::size_t, CLASS_COUNT> avoided = {
+            5,  // none: all
+            4,  // digit: all but numeric_literal
+            2,  // quotation: NULL and enumeration_literal
+            1,  // apostrophe: NULL, the character literal is part of enumeration_literal
+            0,  // letter: the ordered choice is kept
+        };
+        auto const index = static_cast<std::size_t>(char_class);
+        dispatched[index].fetch_add(1, std::memory_order_relaxed);
+        avoided_alternatives.fetch_add(avoided[index], std::memory_order_relaxed);
+    }
+
+    void reset()
+    {
+        for (auto& counter : dispatched) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+        avoided_alternatives.store(0, std::memory_order_relaxed);
+    }
+
+    static dispatch_statistics& instance()
+    {
+        static dispatch_statistics stats;
+        return stats;
+    }
+};
+
+///
+/// Dispatch by the first character to the only plausible alternative(s) of the literal,
+/// instead of trying all alternatives in order with backtracking.
+///
+/// The alternatives must have the literal's attribute type, e.g. as rule of the alternatives.
+/// The letter alternative keeps the ordered choice `NULL | identifier | bit_string_literal`,
+/// since all of them start with a letter; NULL and identifier are recognized by one scan.
+///
+template <typename NumericT, typename StringT, typename CharacterT, typename LetterT>
+struct literal_dispatch_parser
+    : x3::parser<literal_dispatch_parser<NumericT, StringT, CharacterT, LetterT>> {
+    using attribute_type = ast::literal;
+
+    constexpr literal_dispatch_parser(NumericT const& numeric_, StringT const& string_,
+                                      CharacterT const& character_, LetterT const& letter_)
+        : numeric{ numeric_ }
+        , string{ string_ }
+        , character{ character_ }
+        , letter{ letter_ }
+    {
+    }
+
+    template <typename IteratorT, typename ContextT, typename RContextT>
+    bool parse(IteratorT& first, IteratorT const& last, ContextT const& ctx, RContextT& rctx,
+               attribute_type& attribute) const
+    {
+        x3::skip_over(first, last, ctx);
+
+        if (first == last) {
+            return false;
+        }
+
+        auto const char_class = first_char_table[static_cast<unsigned char>(*first)];
+
+#if defined(USE_PARSER_STATISTICS)
+        dispatch_statistics::instance().count(char_class);
+#endif
+
+        switch (char_class) {
+            case first_char_class::digit:
+                return numeric.parse(first, last, ctx, rctx, attribute);
+            case first_char_class::quotation:
+                return string.parse(first, last, ctx, rctx, attribute);
+            case first_char_class::apostrophe:
+                return character.parse(first, last, ctx, rctx, attribute);
+            case first_char_class::letter:
+                return letter.parse(first, last, ctx, rctx, attribute);
+            default:
+                return false;
+        }
+    }
+
+    NumericT numeric;
+    StringT string;
+    CharacterT character;
+    LetterT letter;
+};
+
+///
+/// Create the @ref literal_dispatch_parser of the given alternatives.
+///
+auto const literal_dispatch = [](auto const& numeric, auto const& string, auto const& character,
+                                 auto const& letter) {
+    return literal_dispatch_parser<std::remove_cvref_t<decltype(numeric)>,
+                                   std::remove_cvref_t<decltype(string)>,
+                                   std::remove_cvref_t<decltype(character)>,
+                                   std::remove_cvref_t<decltype(letter)>>{ numeric, string,
+                                                                           character, letter };
+};
+
+}  // namespace parser
+
+namespace boost::spirit::x3 {
+
+template <typename NumericT, typename StringT, typename CharacterT, typename LetterT>
+struct get_info<::parser::literal_dispatch_parser<NumericT, StringT, CharacterT, LetterT>> {
+    using result_type = std::string;
+    std::string operator()(
+        [[maybe_unused]] ::parser::literal_dispatch_parser<NumericT, StringT, CharacterT,
+                                                           LetterT> const&) const
+    {
+        return "literal";
+    }
+};
+
+}  // namespace boost::spirit::x3
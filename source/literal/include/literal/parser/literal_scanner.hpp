@@ -0,0 +1,447 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <literal/ast.hpp>
+#include <literal/parser/char_parser.hpp>
+#include <literal/parser/comment.hpp>
+#include <literal/parser/parse_limits.hpp>
+#include <literal/parser/identifier.hpp>
+#include <literal/parser/string_literal.hpp>
+#include <literal/convert/detail/chr2dec.hpp>
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+namespace parser {
+
+///
+/// Character classes of the literal scanner, as bit flags of @ref scanner_char_table.
+///
+/// The classes are those of the X3 grammar's standard (ASCII) encoding, e.g. `x3::space`
+/// and `x3::graph | x3::space` as graphic character. All characters beyond 7-bit ASCII
+/// are of class none, the scanner leaves them to the X3 grammar.
+///
+namespace scanner_char {
+
+static constexpr std::uint8_t none = 0;
+static constexpr std::uint8_t space = 1U << 0U;
+static constexpr std::uint8_t digit = 1U << 1U;
+static constexpr std::uint8_t alpha = 1U << 2U;
+static constexpr std::uint8_t graphic = 1U << 3U;
+
+}  // namespace scanner_char
+
+namespace detail {
+
+constexpr std::array<std::uint8_t, 256> make_scanner_char_table()
+{
+    std::array<std::uint8_t, 256> table{};  // scanner_char::none
+
+    for (unsigned chr = '!'; chr <= '~'; ++chr) {
+        table[chr] = scanner_char::graphic;
+    }
+    for (unsigned chr : { ' ', '\t', '\n', '\v', '\f', '\r' }) {
+        table[chr] = scanner_char::space | scanner_char::graphic;
+    }
+    for (unsigned chr = '0'; chr <= '9'; ++chr) {
+        table[chr] |= scanner_char::digit;
+    }
+    for (unsigned chr = 'a'; chr <= 'z'; ++chr) {
+        table[chr] |= scanner_char::alpha;
+        table[chr - 'a' + 'A'] |= scanner_char::alpha;
+    }
+
+    return table;
+}
+
+}  // namespace detail
+
+static constexpr auto scanner_char_table = detail::make_scanner_char_table();
+
+///
+/// Table driven scanner of the literal statement `X := literal ;`, the fast path of
+/// valid input.
+///
+/// The scanner recognizes all literals of the X3 grammar in one forward pass and
+/// produces the same `ast::literal` as the X3 grammar does. It doesn't report errors:
+/// if anything isn't recognized, the scanner gives up and leaves the statement to the
+/// X3 grammar, which does the diagnostics and error recovery.
+///
+/// With `USE_IN_PARSER_CONVERT` or `USE_FUSED_PARSER_CONVERT` the numeric values are
+/// converted by the X3 parsers, hence numeric and bit string literals are left to them.
+///
+struct literal_scanner {
+    /// numeric and bit string literals are scanned, otherwise they are left to the X3 parsers
+#if defined(USE_FUSED_PARSER_CONVERT) || defined(USE_IN_PARSER_CONVERT)
+    static bool constexpr scan_numeric_values = false;
+#else
+    static bool constexpr scan_numeric_values = true;
+#endif
+
+    ///
+    /// Scan the statement, the iterator is advanced only on success.
+    ///
+    template <typename IteratorT>
+    bool operator()(IteratorT& first, IteratorT const& last, ast::literal& attribute) const
+    {
+        auto iter = first;
+
+        skip(iter, last);
+        if (!scan_char(iter, last, 'X')) {
+            return false;
+        }
+        skip(iter, last);
+        if (!scan_char(iter, last, ':') || !scan_char(iter, last, '=')) {
+            return false;
+        }
+        skip(iter, last);
+
+        ast::literal literal;
+        if (!scan_literal(iter, last, literal)) {
+            return false;
+        }
+
+        skip(iter, last);
+        if (!scan_char(iter, last, ';')) {
+            return false;
+        }
+
+        first = iter;
+        attribute = std::move(literal);
+        return true;
+    }
+
+    ///
+    /// Skip white space and comments, the same as `x3::space | comment`.
+    ///
+    template <typename IteratorT>
+    static void skip(IteratorT& iter, IteratorT const& last)
+    {
+        iter = detail::skip_space_and_comments(iter, last);
+    }
+
+private:
+    static bool is(char chr, std::uint8_t char_class)
+    {
+        return (scanner_char_table[static_cast<unsigned char>(chr)] & char_class) != 0;
+    }
+
+    template <typename IteratorT>
+    static bool scan_char(IteratorT& iter, IteratorT const& last, char chr)
+    {
+        if (iter == last || *iter != chr) {
+            return false;
+        }
+        ++iter;
+        return true;
+    }
+
+    ///
+    /// Delimited digits `digit { [ '_' ] digit }` of the base. Digits exceeding the
+    /// @ref parse_limits are left to the X3 grammar to be reported.
+    ///
+    template <typename IteratorT>
+    static bool scan_digits(IteratorT& iter, IteratorT const& last, unsigned base)
+    {
+        auto const max_digits = parse_limits::current().max_digits(base);
+        auto const digits_last = char_parser::detail::scan_based_digits(
+            iter, detail::bounded_digits_last(iter, last, max_digits), base);
+        if (digits_last == iter ||
+            detail::exceeding_digit(iter, digits_last, max_digits) != digits_last) {
+            return false;
+        }
+        iter = digits_last;
+        return true;
+    }
+
+    template <typename IteratorT>
+    static bool scan_literal(IteratorT& iter, IteratorT const& last, ast::literal& literal)
+    {
+        if (iter == last) {
+            return false;
+        }
+
+        auto const chr = *iter;
+
+        if (is(chr, scanner_char::digit)) {
+            return scan_numeric_values && scan_numeric(iter, last, literal);
+        }
+        if (is(chr, scanner_char::alpha)) {
+            return scan_word(iter, last, literal);
+        }
+        if (chr == '"' || chr == '%') {
+            return scan_string(iter, last, literal);
+        }
+        if (chr == '\'') {
+            return scan_character(iter, last, literal);
+        }
+        return false;
+    }
+
+    // BNF: numeric_literal ::= abstract_literal | physical_literal, @see numeric_literal_parser
+    template <typename IteratorT>
+    static bool scan_numeric(IteratorT& iter, IteratorT const& last, ast::literal& literal)
+    {
+        auto const leading_first = iter;
+        if (!scan_digits(iter, last, 10U)) {
+            return false;
+        }
+
+        unsigned base = 10U;
+        bool const is_based = iter != last && *iter == '#';
+        auto integer_first = leading_first;
+
+        if (is_based) {
+            base = base_of(leading_first, iter);
+            if (!char_parser::valid_base(base)) {
+                return false;
+            }
+            integer_first = ++iter;
+            if (!scan_digits(iter, last, base)) {
+                return false;
+            }
+        }
+        auto const integer_last = iter;
+
+        bool is_real = false;
+        auto fractional_first = iter;
+        if (iter != last && *iter == '.') {
+            fractional_first = ++iter;
+            if (!scan_digits(iter, last, base)) {
+                return false;
+            }
+            is_real = true;
+        }
+        auto const fractional_last = iter;
+
+        if (is_based && !scan_char(iter, last, '#')) {
+            return false;
+        }
+
+        // optional exponent `E [ sign ] integer`, the spelling is the signed integer
+        auto exponent_first = iter;
+        auto exponent_last = iter;
+        if (iter != last && (*iter == 'E' || *iter == 'e')) {
+            auto exp_iter = std::next(iter);
+            auto const sign_first = exp_iter;
+            if (exp_iter != last && (*exp_iter == '+' || (is_real && *exp_iter == '-'))) {
+                ++exp_iter;
+            }
+            if (scan_digits(exp_iter, last, 10U)) {
+                exponent_first = sign_first;
+                exponent_last = iter = exp_iter;
+            }
+        }
+
+        ast::abstract_literal abstract;
+        if (is_real) {
+            ast::real_type real;
+            real.base = base;
+            real.integer.assign(integer_first, integer_last);
+            real.fractional.assign(fractional_first, fractional_last);
+            real.exponent.assign(exponent_first, exponent_last);
+            abstract = make_abstract(is_based, std::move(real));
+        }
+        else {
+            ast::integer_type int_;
+            int_.base = base;
+            int_.integer.assign(integer_first, integer_last);
+            int_.exponent.assign(exponent_first, exponent_last);
+            abstract = make_abstract(is_based, std::move(int_));
+        }
+
+        // BNF: physical_literal ::= [ abstract_literal ] unit_name
+        auto unit_first = iter;
+        skip(unit_first, last);
+        auto const max_length = parse_limits::current().max_identifier_length;
+        auto const unit_bound = detail::bounded_last(unit_first, last, max_length + 1);
+        auto unit_last = unit_first;
+        while (unit_last != unit_bound && is(*unit_last, scanner_char::alpha)) {
+            ++unit_last;
+        }
+
+        if (static_cast<std::size_t>(std::distance(unit_first, unit_last)) > max_length) {
+            return false;  // reported by the X3 grammar
+        }
+
+        if (unit_last == unit_first) {
+            literal = ast::numeric_literal{ std::move(abstract) };
+            return true;
+        }
+
+        ast::physical_literal physical;
+        physical.literal = std::move(abstract);
+        physical.unit_name.assign(unit_first, unit_last);
+        literal = ast::numeric_literal{ std::move(physical) };
+        iter = unit_last;
+
+        return true;
+    }
+
+    /// The base specifier's value, an overflowing base is invalid anyway.
+    template <typename IteratorT>
+    static unsigned base_of(IteratorT first, IteratorT const& last)
+    {
+        unsigned base = 0;
+        for (; first != last; ++first) {
+            if (*first == '_') {
+                continue;
+            }
+            base = base * 10U + convert::detail::chr2dec(*first);
+            if (base > 36U) {
+                return 0;
+            }
+        }
+        return base;
+    }
+
+    template <typename NumT>
+    static ast::abstract_literal make_abstract(bool is_based, NumT&& num)
+    {
+        ast::abstract_literal abstract;
+        if (is_based) {
+            ast::based_literal based;
+            based.num = std::forward<NumT>(num);
+            abstract = std::move(based);
+        }
+        else {
+            ast::decimal_literal decimal;
+            decimal.num = std::forward<NumT>(num);
+            abstract = std::move(decimal);
+        }
+        return abstract;
+    }
+
+    // NULL, identifier or bit_string_literal, in this order
+    template <typename IteratorT>
+    static bool scan_word(IteratorT& iter, IteratorT const& last, ast::literal& literal)
+    {
+        auto const max_length = parse_limits::current().max_identifier_length;
+        auto const bound = detail::bounded_last(iter, last, max_length + 1);
+
+        auto const word_first = iter;
+        auto const word_last = detail::scan_word_chars(std::next(iter), bound);
+
+        if (static_cast<std::size_t>(std::distance(word_first, word_last)) > max_length) {
+            return false;  // reported by the X3 grammar
+        }
+
+        auto const keyword = lookup_keyword(word_first, word_last);
+
+        if (keyword == null_keyword) {
+            // same as `x3::attr("kw:NULL")` of NULL_, which assigns the whole char array,
+            // including the terminating null character
+            static constexpr char null_name[] = "kw:NULL";
+            ast::identifier null;
+            null.name.assign(std::begin(null_name), std::end(null_name));
+            literal = std::move(null);
+            iter = word_last;
+            return true;
+        }
+
+        // BNF: bit_string_literal ::= base_specifier " [ bit_value ] "
+        if (std::next(word_first) == word_last && word_last != last && *word_last == '"') {
+            return scan_bit_string(iter, last, detail::to_lower(*word_first), literal);
+        }
+
+        if (keyword != no_keyword) {
+            return false;
+        }
+
+        ast::identifier identifier;
+        identifier.name.assign(word_first, word_last);
+        literal = ast::enumeration_literal{ std::move(identifier) };
+        iter = word_last;
+
+        return true;
+    }
+
+    template <typename IteratorT>
+    static bool scan_bit_string(IteratorT& iter, IteratorT const& last, char base_id,
+                                ast::literal& literal)
+    {
+        if (!scan_numeric_values) {
+            return false;
+        }
+
+        unsigned base = 0;
+        switch (base_id) {
+            case 'b':
+                base = 2U;
+                break;
+            case 'o':
+                base = 8U;
+                break;
+            case 'x':
+                base = 16U;
+                break;
+            default:
+                return false;
+        }
+
+        auto scan_iter = std::next(iter, 2);  // base specifier and '"'
+        auto const digits_first = scan_iter;
+        scan_digits(scan_iter, last, base);  // optional
+        auto const digits_last = scan_iter;
+
+        if (!scan_char(scan_iter, last, '"')) {
+            return false;
+        }
+
+        ast::bit_string_literal bit_string;
+        bit_string.base = base;
+        bit_string.literal.assign(digits_first, digits_last);
+        literal = std::move(bit_string);
+        iter = scan_iter;
+
+        return true;
+    }
+
+    // BNF: string_literal ::= " { graphic_character } "
+    template <typename IteratorT>
+    static bool scan_string(IteratorT& iter, IteratorT const& last, ast::literal& literal)
+    {
+        detail::string_body<IteratorT> body;
+        if (!detail::scan_string_body(std::next(iter), last, *iter, body)) {
+            return false;
+        }
+
+        ast::string_literal string;
+        string.literal.assign(body.first, body.last);
+        literal = std::move(string);
+        iter = std::next(body.last);
+
+        return true;
+    }
+
+    // BNF: character_literal ::= ' graphic_character '
+    template <typename IteratorT>
+    static bool scan_character(IteratorT& iter, IteratorT const& last, ast::literal& literal)
+    {
+        auto scan_iter = std::next(iter);
+        if (scan_iter == last || !is(*scan_iter, scanner_char::graphic)) {
+            return false;
+        }
+        auto const chr = *scan_iter++;
+        if (!scan_char(scan_iter, last, '\'')) {
+            return false;
+        }
+
+        ast::character_literal character;
+        character.literal = chr;
+        literal = ast::enumeration_literal{ character };
+        iter = scan_iter;
+
+        return true;
+    }
+};
+
+static literal_scanner const scan_literal_statement = {};
+
+}  // namespace parser
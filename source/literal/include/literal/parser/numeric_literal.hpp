@@ -0,0 +1,314 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <literal/ast.hpp>
+#include <literal/parser/char_parser.hpp>
+#include <literal/parser/decimal_literal.hpp>
+#include <literal/parser/based_literal.hpp>
+#include <literal/parser/parse_limits.hpp>
+#include <literal/parser/util/scan_statistics.hpp>
+#include <literal/convert/leaf_error_handler.hpp>
+#include <literal/convert/convert.hpp>
+
+#include <boost/spirit/home/x3.hpp>
+
+#include <boost/leaf.hpp>
+
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace parser {
+
+namespace x3 = boost::spirit::x3;
+namespace leaf = boost::leaf;
+
+namespace detail {
+
+///
+/// The digit runs of a scanned abstract literal.
+///
+template <typename IteratorT>
+struct scanned_number {
+    unsigned base = 10U;
+    bool is_based = false;
+    bool is_real = false;
+    digit_run<IteratorT> integer;
+    digit_run<IteratorT> fractional;
+    digit_run<IteratorT> exponent;
+};
+
+///
+/// Parse the unit name `+alpha` of a physical literal, which is bounded by the identifier
+/// length of the @ref parse_limits.
+///
+template <typename IteratorT>
+bool parse_unit_name(IteratorT& first, IteratorT const& last, std::string& unit_name)
+{
+    auto const max_length = parse_limits::current().max_identifier_length;
+    auto const bound = bounded_last(first, last, max_length + 1);
+
+    auto iter = first;
+    if (!x3::parse(iter, bound, x3::lexeme[+x3::alpha], unit_name)) {
+        return false;
+    }
+
+    if (static_cast<std::size_t>(std::distance(first, iter)) > max_length) {
+        throw x3::expectation_failure<IteratorT>(
+            std::next(first, static_cast<std::ptrdiff_t>(max_length)),
+            parse_limits::exceeded("unit name", max_length));
+    }
+
+    first = iter;
+    return true;
+}
+
+}  // namespace detail
+
+// BNF: unit_name ::= letter { letter }, bounded by the parse limits
+struct unit_name_parser : x3::parser<unit_name_parser> {
+    using attribute_type = std::string;
+
+    template <typename IteratorT, typename ContextT, typename RContextT>
+    bool parse(IteratorT& first, IteratorT const& last, ContextT const& ctx,
+               [[maybe_unused]] RContextT const&, attribute_type& attribute) const
+    {
+        x3::skip_over(first, last, ctx);
+        return detail::parse_unit_name(first, last, attribute);
+    }
+};
+
+static unit_name_parser const bounded_unit_name = {};
+
+// BNF: numeric_literal ::= abstract_literal | physical_literal
+//
+// Longest match of the numeric literal, which scans the literal once and decides between
+// decimal/based integer/real and physical literal by what follows. This is equivalent to
+// the ordered choice `physical_literal | abstract_literal` with `abstract_literal ::=
+// based_literal | decimal_literal`, but without re-scanning the digits of each alternative.
+//
+// The expectation failures are those of the X3 composition, except for an overflowing
+// base specifier, which is reported as invalid base.
+struct numeric_literal_parser : x3::parser<numeric_literal_parser> {
+    using attribute_type = ast::numeric_literal;
+
+    template <typename IteratorT, typename ContextT, typename RContextT>
+    bool parse(IteratorT& first, IteratorT const& last, ContextT const& ctx,
+               [[maybe_unused]] RContextT const&, attribute_type& attribute) const
+    {
+        LEAF_ERROR_TRACE;
+
+        skip_over(first, last, ctx);
+
+        auto const begin = first;
+        auto iter = first;
+
+        detail::scanned_number<IteratorT> number;
+        if (!scan_abstract_literal(iter, last, number)) {
+            return false;
+        }
+
+        // BNF: physical_literal ::= [ abstract_literal ] unit_name, where the unit name
+        // may be separated by the skipper
+        auto unit_iter = iter;
+        x3::skip_over(unit_iter, last, ctx);
+
+        std::string unit_name;
+        bool const is_physical = detail::parse_unit_name(unit_iter, last, unit_name);
+        scan_statistics::count_inspected(std::distance(iter, unit_iter) + 1);
+
+        first = is_physical ? unit_iter : iter;
+        scan_statistics::count_literal(std::distance(begin, first));
+
+        ast::abstract_literal abstract = number.is_real
+                                             ? make_abstract_literal(number, make_real(number))
+                                             : make_abstract_literal(number, make_integer(number));
+
+#if defined(USE_FUSED_PARSER_CONVERT) || defined(USE_IN_PARSER_CONVERT)
+        leaf::try_catch(
+            [&] {
+                auto load = leaf::on_error(leaf::e_x3_parser_context{ *this, first, begin });
+
+                // LEAF - from_chars() or power() may fail
+                boost::apply_visitor(
+                    [&](auto& literal) {
+                        boost::apply_visitor(
+                            [&](auto& num) { convert_value(num, number); }, literal.num);
+                    },
+                    abstract);
+                return true;
+            },
+            convert::leaf_error_handlers<IteratorT>);
+#endif
+
+        if (!is_physical) {
+            attribute = std::move(abstract);
+            return true;
+        }
+
+        ast::physical_literal physical;
+        physical.literal = std::move(abstract);
+        physical.unit_name = std::move(unit_name);
+        attribute = std::move(physical);
+
+        return true;
+    }
+
+private:
+    ///
+    /// abstract_literal ::= decimal_literal | based_literal, where both start with a
+    /// decimal integer, for the based literal it's the base specifier.
+    ///
+    template <typename IteratorT>
+    static bool scan_abstract_literal(IteratorT& iter, IteratorT const& last,
+                                      detail::scanned_number<IteratorT>& number)
+    {
+        detail::digit_run<IteratorT> leading;
+        if (!detail::scan_digit_run(iter, last, 10U, leading)) {
+            return false;
+        }
+
+        if (iter == last || *iter != '#') {
+            // BNF: decimal_literal ::= integer [ . integer ] [ exponent ]
+            number.integer = leading;
+            return scan_number_tail(iter, last, number);
+        }
+
+        // BNF: based_literal ::= base # based_integer [ . based_integer ] # [ exponent ]
+        ++iter;
+
+        number.is_based = true;
+        number.base = leading.digits.overflow_offset ? 0U : leading.digits.value;
+
+        if (!char_parser::valid_base(number.base)) {
+            throw x3::expectation_failure<IteratorT>(iter, "valid base specifier");
+        }
+
+        if (!detail::scan_digit_run(iter, last, number.base, number.integer)) {
+            return false;
+        }
+
+        return scan_number_tail(iter, last, number);
+    }
+
+    ///
+    /// The remaining `[ . integer ] [ # ] [ exponent ]` behind the integer part of the
+    /// number, where the closing '#' is of based literals only.
+    ///
+    template <typename IteratorT>
+    static bool scan_number_tail(IteratorT& iter, IteratorT const& last,
+                                 detail::scanned_number<IteratorT>& number)
+    {
+        scan_statistics::count_inspected(1);
+        if (iter != last && *iter == '.') {
+            ++iter;
+
+            if (!detail::scan_digit_run(iter, last, number.base, number.fractional)) {
+                throw x3::expectation_failure<IteratorT>(
+                    iter, number.is_based ? x3::what(detail::base_digits(number.base))
+                                          : x3::what(char_parser::dec_digits));
+            }
+            number.is_real = true;
+        }
+
+        if (number.is_based) {
+            scan_statistics::count_inspected(1);
+            if (iter == last || *iter != '#') {
+                return false;
+            }
+            ++iter;
+        }
+
+        detail::scan_exponent(iter, last, number.is_real ? "-+" : "+", number.exponent);
+
+        return true;
+    }
+
+    template <typename IteratorT>
+    static ast::real_type make_real(detail::scanned_number<IteratorT> const& number)
+    {
+        ast::real_type real;
+        real.base = number.base;
+        real.integer.assign(number.integer.first, number.integer.last);
+        real.fractional.assign(number.fractional.first, number.fractional.last);
+        real.exponent.assign(number.exponent.first, number.exponent.last);
+        return real;
+    }
+
+    template <typename IteratorT>
+    static ast::integer_type make_integer(detail::scanned_number<IteratorT> const& number)
+    {
+        ast::integer_type int_;
+        int_.base = number.base;
+        int_.integer.assign(number.integer.first, number.integer.last);
+        int_.exponent.assign(number.exponent.first, number.exponent.last);
+        return int_;
+    }
+
+    template <typename IteratorT, typename NumT>
+    static ast::abstract_literal make_abstract_literal(
+        detail::scanned_number<IteratorT> const& number, NumT&& num)
+    {
+        ast::abstract_literal abstract;
+        if (number.is_based) {
+            ast::based_literal based;
+            based.num = std::forward<NumT>(num);
+            abstract = std::move(based);
+        }
+        else {
+            ast::decimal_literal decimal;
+            decimal.num = std::forward<NumT>(num);
+            abstract = std::move(decimal);
+        }
+        return abstract;
+    }
+
+#if defined(USE_FUSED_PARSER_CONVERT) || defined(USE_IN_PARSER_CONVERT)
+    template <typename IteratorT>
+    static void convert_value(ast::integer_type& int_,
+                              [[maybe_unused]] detail::scanned_number<IteratorT> const& number)
+    {
+#if defined(USE_FUSED_PARSER_CONVERT)
+        // LEAF - overflow, or power() may fail
+        int_.value = detail::fused_integer_value(number.base, number.integer, number.exponent);
+#else
+        // LEAF - from_chars() or power() may fail
+        int_.value = convert::integer<ast::integer_type::value_type>(int_);
+#endif
+    }
+
+    template <typename IteratorT>
+    static void convert_value([[maybe_unused]] ast::real_type& real,
+                              [[maybe_unused]] detail::scanned_number<IteratorT> const& number)
+    {
+        // Same as the X3 composition of decimal_real and based_real, there is no fused
+        // conversion of reals.
+#if defined(USE_IN_PARSER_CONVERT)
+        // LEAF - from_chars() or power() may fail
+        real.value = convert::real<ast::real_type::value_type>(real);
+#endif
+    }
+#endif
+};
+
+static numeric_literal_parser const single_pass_numeric_literal = {};
+
+}  // namespace parser
+
+namespace boost::spirit::x3 {
+
+template <>
+struct get_info<::parser::numeric_literal_parser> {
+    using result_type = std::string;
+    std::string operator()([[maybe_unused]] ::parser::numeric_literal_parser const&) const
+    {
+        return "numeric literal";
+    }
+};
+
+}  // namespace boost::spirit::x3
@@ -0,0 +1,206 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <boost/spirit/home/x3.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <string>
+
+namespace parser {
+
+namespace x3 = boost::spirit::x3;
+
+///
+/// Limits of the lexemes to be parsed, which bound the effort (e.g. string copies and
+/// conversion) of a malicious or broken input, e.g. a single literal of 100 MB. Hitting
+/// a limit fails fast with an expectation failure, the diagnostic tells the limit.
+///
+/// The limits are configured per parse session by @ref parse_limits_scope, otherwise the
+/// default limits apply.
+///
+struct parse_limits {
+    /// The width of the numeric values in bits, which bounds the digits of the digit
+    /// runs (integer, fractional, exponent and bit value), see @ref max_digits().
+    std::size_t max_value_bits = 4096;
+    std::size_t max_identifier_length = 1024;
+    std::size_t max_string_length = 64 * 1024;
+    std::size_t max_statement_length = 1024 * 1024;
+
+    ///
+    /// The count of digits of a digit run of the base, the '_' delimiters aren't counted.
+    /// The count is sufficient to represent a value of @ref max_value_bits, e.g. 4096 bits
+    /// are 4096 binary or 1024 hexadecimal digits.
+    ///
+    std::size_t max_digits(unsigned base) const
+    {
+        // bits per digit rounded down, i.e. a generous bound for non power of 2 bases
+        auto const bits_per_digit = static_cast<std::size_t>(std::bit_width(base) - 1);
+        return max_value_bits / std::max<std::size_t>(bits_per_digit, 1);
+    }
+
+    /// The diagnostic of a lexeme, which exceeds the limit.
+    static std::string exceeded(char const* lexeme, std::size_t limit,
+                                char const* unit = "characters")
+    {
+        return fmt::format("{} of at most {} {}", lexeme, limit, unit);
+    }
+
+    ///
+    /// The limits of the current parse session.
+    ///
+    static parse_limits const& current()
+    {
+        static parse_limits const defaults;
+        auto const* const limits = session();
+        return limits != nullptr ? *limits : defaults;
+    }
+
+private:
+    friend class parse_limits_scope;
+
+    static parse_limits const*& session()
+    {
+        thread_local parse_limits const* limits = nullptr;
+        return limits;
+    }
+};
+
+///
+/// The scope of a parse session, which applies the given limits to the parsers of the
+/// (current) thread. Scopes may be nested, the previous limits are restored on exit.
+///
+class parse_limits_scope {
+public:
+    explicit parse_limits_scope(parse_limits const& limits)
+        : previous{ parse_limits::session() }
+    {
+        parse_limits::session() = &limits;
+    }
+
+    ~parse_limits_scope() { parse_limits::session() = previous; }
+
+    parse_limits_scope(parse_limits_scope const&) = delete;
+    parse_limits_scope& operator=(parse_limits_scope const&) = delete;
+
+private:
+    parse_limits const* const previous;
+};
+
+namespace detail {
+
+///
+/// The end of the range [first, last) bounded to the count of characters.
+///
+template <typename IteratorT>
+IteratorT bounded_last(IteratorT const& first, IteratorT const& last, std::size_t count)
+{
+    using difference_type = std::iter_difference_t<IteratorT>;
+    auto constexpr max = static_cast<std::size_t>(std::numeric_limits<difference_type>::max());
+    return std::ranges::next(first, static_cast<difference_type>(std::min(count, max)), last);
+}
+
+///
+/// The end of the range [first, last) to scan a digit run of at most `max_digits`, the
+/// delimiters '_' in between the digits included. The bound is one digit beyond the
+/// limit to detect exceeding digits.
+///
+template <typename IteratorT>
+IteratorT bounded_digits_last(IteratorT const& first, IteratorT const& last,
+                              std::size_t max_digits)
+{
+    auto constexpr max = std::numeric_limits<std::size_t>::max();
+    // each digit but the first may be preceded by a delimiter
+    auto const count = (max_digits < max / 2) ? 2 * max_digits + 1 : max;
+    return bounded_last(first, last, count);
+}
+
+///
+/// The first digit of the digit run [first, last) beyond `max_digits`, where the
+/// delimiters '_' aren't counted.
+///
+/// @return The iterator to the exceeding digit, or `last` if the run is within the limit.
+///
+template <typename IteratorT>
+IteratorT exceeding_digit(IteratorT first, IteratorT const& last, std::size_t max_digits)
+{
+    if (static_cast<std::size_t>(std::distance(first, last)) <= max_digits) {
+        // not more characters than digits allowed
+        return last;
+    }
+
+    std::size_t count = 0;
+    for (; first != last; ++first) {
+        if (*first != '_' && count++ == max_digits) {
+            break;
+        }
+    }
+    return first;
+}
+
+}  // namespace detail
+
+///
+/// Directive of the statement length limit. The limit is checked after the statement has
+/// been parsed, since the lexemes of the statement are bounded already, it doesn't bound
+/// the effort but the statement's spelling.
+///
+template <typename SubjectT>
+struct statement_limit_directive
+    : x3::unary_parser<SubjectT, statement_limit_directive<SubjectT>> {
+    using base_type = x3::unary_parser<SubjectT, statement_limit_directive<SubjectT>>;
+    static bool const is_pass_through_unary = true;
+
+    constexpr statement_limit_directive(SubjectT const& subject)
+        : base_type(subject)
+    {
+    }
+
+    template <typename IteratorT, typename ContextT, typename RContextT, typename AttributeT>
+    bool parse(IteratorT& first, IteratorT const& last, ContextT const& ctx, RContextT& rctx,
+               AttributeT& attribute) const
+    {
+        x3::skip_over(first, last, ctx);
+
+        auto const begin = first;
+
+        if (!this->subject.parse(first, last, ctx, rctx, attribute)) {
+            return false;
+        }
+
+        auto const max_length = parse_limits::current().max_statement_length;
+        if (static_cast<std::size_t>(std::distance(begin, first)) > max_length) {
+            throw x3::expectation_failure<IteratorT>(
+                std::next(begin, static_cast<std::ptrdiff_t>(max_length)),
+                parse_limits::exceeded("statement", max_length));
+        }
+
+        return true;
+    }
+};
+
+namespace detail {
+
+struct statement_limit_gen {
+    template <typename SubjectT>
+    constexpr statement_limit_directive<typename x3::extension::as_parser<SubjectT>::value_type>
+    operator[](SubjectT const& subject) const
+    {
+        return { x3::as_parser(subject) };
+    }
+};
+
+}  // namespace detail
+
+static auto const statement_limit = detail::statement_limit_gen{};
+
+}  // namespace parser
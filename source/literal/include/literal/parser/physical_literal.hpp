@@ -14,6 +14,20 @@ namespace parser {
 
 namespace x3 = boost::spirit::x3;
 
+namespace detail {
+
+// Note, the LRM doesn't specify the allowed characters, hence it's assumed
+// that it follows the natural conventions.
+static auto const physical_unit_name = x3::rule<struct unit_name_class, std::string>{ "unit name" } =
+    x3::lexeme[ +x3::alpha ]
+    ;
+
+static auto const physical_literal_grammar = x3::lexeme [
+    abstract_literal >> physical_unit_name
+];
+
+}  // namespace detail
+
 // BNF: physical_literal ::= [ abstract_literal ] unit_name
 //
 // ATTENTION:In the BNF, the abstract_literal is optional. This may lead to a standalone
@@ -29,17 +43,7 @@ struct physical_literal_parser : x3::parser<physical_literal_parser> {
     {
         skip_over(first, last, ctx);
 
-        // Note, the LRM doesn't specify the allowed characters, hence it's assumed
-        // that it follows the natural conventions.
-        auto const unit_name = x3::rule<struct unit_name_class, std::string>{ "unit name" } =
-            x3::lexeme[ +x3::alpha ]
-            ;
-
-        auto const grammar = x3::lexeme [
-            abstract_literal >> unit_name
-        ];
-
-        auto const parse_ok = x3::parse(first, last, grammar, attribute);
+        auto const parse_ok = x3::parse(first, last, detail::physical_literal_grammar, attribute);
 
         if (!parse_ok) {
             return false;
@@ -9,13 +9,136 @@
 
 #include <literal/ast.hpp>
 #include <literal/parser/graphic_character.hpp>
+#include <literal/parser/parse_limits.hpp>
+#include <literal/parser/util/simd_scan.hpp>
 
 #include <fmt/format.h>
 
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
 namespace parser {
 
 namespace x3 = boost::spirit::x3;
 
+namespace detail {
+
+///
+/// The body of a string literal, the span between its delimiters. The spelling of a
+/// doubled delimiter is kept, see @ref unescaped.
+///
+template <typename IteratorT>
+struct string_body {
+    IteratorT first{};
+    IteratorT last{};
+    /// the delimiter of the literal, '"' or '%'
+    char delimiter = '"';
+    /// the body contains the doubled delimiter, which has to be unescaped to get the value
+    bool has_doubled_delimiter = false;
+    /// the body exceeds the string length of the parse limits
+    bool exceeds_limit = false;
+
+    ///
+    /// The value of the body. It's a view on the input, the body is copied into the buffer
+    /// only if it contains a doubled delimiter, or the input isn't contiguous.
+    ///
+    std::string_view unescaped(std::string& buffer) const
+    {
+        if constexpr (std::contiguous_iterator<IteratorT> &&
+                      std::is_same_v<std::iter_value_t<IteratorT>, char>) {
+            if (!has_doubled_delimiter) {
+                return { std::to_address(first),
+                         static_cast<std::size_t>(std::distance(first, last)) };
+            }
+        }
+
+        buffer.clear();
+        for (auto iter = first; iter != last; ++iter) {
+            buffer.push_back(*iter);
+            if (*iter == delimiter) {
+                ++iter;  // skip the doubled one
+            }
+        }
+        return buffer;
+    }
+};
+
+///
+/// Scan the body `{ graphic_character }` behind the opening delimiter up to the closing
+/// one, where a doubled delimiter is part of the body. The delimiter and non-graphic
+/// characters are searched vectorized on contiguous memory.
+///
+/// The scan is bounded by the string length of the @ref parse_limits.
+///
+/// @return false, if there is no closing delimiter or a non-graphic character, or the body
+/// exceeds the limit.
+///
+template <typename IteratorT>
+bool scan_string_body(IteratorT const& first, IteratorT const& last, char delim,
+                      string_body<IteratorT>& body)
+{
+    auto const find_stop = [delim](IteratorT iter, IteratorT const& end) {
+        if constexpr (std::contiguous_iterator<IteratorT> &&
+                      std::is_same_v<std::iter_value_t<IteratorT>, char>) {
+            if (iter == end) {
+                return iter;
+            }
+            auto const* const ptr = std::to_address(iter);
+            auto const* const ptr_end = ptr + std::distance(iter, end);
+            return std::next(iter, simd::find_delimiter_or_non_graphic(ptr, ptr_end, delim) - ptr);
+        }
+        else {
+            while (iter != end && *iter != delim && simd::detail::is_graphic(*iter)) {
+                ++iter;
+            }
+            return iter;
+        }
+    };
+
+    auto const max_length = parse_limits::current().max_string_length;
+    auto const bound = bounded_last(first, last, max_length + 1);  // body and delimiter
+
+    body.first = first;
+    body.delimiter = delim;
+    body.has_doubled_delimiter = false;
+    body.exceeds_limit = false;
+
+    auto iter = first;
+    for (;;) {
+        iter = find_stop(iter, bound);
+
+        if (iter == bound) {
+            body.exceeds_limit = bound != last;
+            return false;
+        }
+
+        if (*iter != delim) {
+            return false;
+        }
+
+        auto const next = std::next(iter);
+        if (next == last || *next != delim) {
+            break;
+        }
+
+        if (next == bound) {
+            body.exceeds_limit = true;
+            return false;
+        }
+
+        body.has_doubled_delimiter = true;
+        iter = std::next(next);
+    }
+
+    body.last = iter;
+    return true;
+}
+
+}  // namespace detail
+
 // BNF: string_literal ::= " { graphic_character } "
 struct string_literal_parser : x3::parser<string_literal_parser> {
     using attribute_type = ast::string_literal;
@@ -26,31 +149,25 @@ struct string_literal_parser : x3::parser<string_literal_parser> {
     {
         skip_over(first, last, ctx);
 
-        auto const string_literal_charset = [](char delim) {
-            return x3::rule<struct _, std::string>{ "string literal charset" } =
-            *(   ( graphic_character - x3::char_(delim)  )
-            | ( x3::char_(delim) >> x3::char_(delim) )
-            )
-            ;
-        };
-
-        auto const string_literal = [&](char delim) {
-            return x3::rule<struct _, std::string>{ "string literal" } =
-                x3::lit(delim) >> x3::raw[string_literal_charset(delim)] >> x3::lit(delim)
-            ;
-        };
-
-        auto const grammar = x3::lexeme [
-            string_literal('"') | string_literal('%')
-        ];
-
-        auto const parse_ok = x3::parse(first, last, grammar, attribute);
+        // BNF: string_literal ::= " { graphic_character } " | % { graphic_character } %
+        if (first == last || (*first != '"' && *first != '%')) {
+            return false;
+        }
 
-        if (!parse_ok) {
-            //std::cout << "string_literal_parser failed\n";
+        detail::string_body<IteratorT> body;
+        if (!detail::scan_string_body(std::next(first), last, *first, body)) {
+            if (body.exceeds_limit) {
+                auto const max_length = parse_limits::current().max_string_length;
+                throw x3::expectation_failure<IteratorT>(
+                    std::next(body.first, static_cast<std::ptrdiff_t>(max_length)),
+                    parse_limits::exceeded("string literal", max_length));
+            }
             return false;
         }
 
+        attribute.literal.assign(body.first, body.last);
+        first = std::next(body.last);
+
         return true;
     }
 };
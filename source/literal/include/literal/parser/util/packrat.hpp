@@ -0,0 +1,294 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <boost/spirit/home/x3.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace parser {
+
+namespace x3 = boost::spirit::x3;
+
+///
+/// Counter of the memoized parser invocations, counted only if `USE_PARSER_STATISTICS` is
+/// defined.
+///
+/// A hit is a repeated attempt of the same parser at the same position within the same
+/// packrat scope, which hasn't been parsed again.
+///
+struct packrat_statistics {
+    std::atomic<std::size_t> lookups = 0;
+    std::atomic<std::size_t> hits = 0;
+
+    double hit_rate() const
+    {
+        auto const count = lookups.load(std::memory_order_relaxed);
+        return count != 0 ? static_cast<double>(hits.load(std::memory_order_relaxed)) /
+                                static_cast<double>(count)
+                          : 0.0;
+    }
+
+    void reset()
+    {
+        lookups.store(0, std::memory_order_relaxed);
+        hits.store(0, std::memory_order_relaxed);
+    }
+
+    static packrat_statistics& instance()
+    {
+        static packrat_statistics stats;
+        return stats;
+    }
+
+    static void count_lookup([[maybe_unused]] bool hit)
+    {
+#if defined(USE_PARSER_STATISTICS)
+        instance().lookups.fetch_add(1, std::memory_order_relaxed);
+        if (hit) {
+            instance().hits.fetch_add(1, std::memory_order_relaxed);
+        }
+#endif
+    }
+};
+
+namespace detail {
+
+///
+/// The (thread local) packrat scope, e.g. of a statement. The position of the memoized
+/// results is keyed relative to the scope's begin.
+///
+template <typename IteratorT>
+struct packrat_session {
+    unsigned depth = 0;
+    std::size_t generation = 0;
+    IteratorT begin = {};
+
+    static packrat_session& instance()
+    {
+        thread_local packrat_session session;
+        return session;
+    }
+};
+
+template <typename IteratorT, typename AttributeT>
+struct memo_entry {
+    bool success;
+    IteratorT last;
+    AttributeT attribute;
+};
+
+template <typename T>
+struct is_rule : std::false_type {};
+
+template <typename ID, typename AttributeT, bool force_attribute>
+struct is_rule<x3::rule<ID, AttributeT, force_attribute>> : std::true_type {};
+
+template <typename ID, typename RHS, typename AttributeT, bool force_attribute>
+struct is_rule<x3::rule_definition<ID, RHS, AttributeT, force_attribute>> : std::true_type {};
+
+///
+/// The identity of the memoized parser beside of its type. Rules are identified by their ID
+/// and stateless parsers by their type, hence all uses of e.g. `memoize[abstract_literal]`
+/// share their results. Other parsers of the same type, e.g. `x3::lit('a')` and
+/// `x3::lit('b')`, are distinguished by their address.
+///
+template <typename SubjectT>
+void const* memo_identity(SubjectT const& subject)
+{
+    if constexpr (is_rule<SubjectT>::value || std::is_empty_v<SubjectT>) {
+        return nullptr;
+    }
+    else {
+        return std::addressof(subject);
+    }
+}
+
+struct memo_key {
+    void const* identity;
+    std::ptrdiff_t position;
+
+    bool operator==(memo_key const&) const = default;
+};
+
+struct memo_key_hash {
+    std::size_t operator()(memo_key const& key) const
+    {
+        auto const hash = std::hash<void const*>{}(key.identity);
+        return hash ^ (std::hash<std::ptrdiff_t>{}(key.position) + 0x9e3779b97f4a7c15ULL +
+                       (hash << 6) + (hash >> 2));
+    }
+};
+
+///
+/// The memoized results of the parsers of one type, valid within the scope of the
+/// generation only.
+///
+template <typename SubjectT, typename IteratorT, typename AttributeT>
+struct memo_table {
+    std::size_t generation = 0;
+    // the nodes of the dropped entries are reused, no allocations once warmed up
+    std::pmr::unsynchronized_pool_resource pool;
+    std::pmr::unordered_map<memo_key, memo_entry<IteratorT, AttributeT>, memo_key_hash> entries{
+        &pool
+    };
+
+    static memo_table& instance(packrat_session<IteratorT> const& session)
+    {
+        thread_local memo_table table;
+        if (table.generation != session.generation) {
+            table.entries.clear();  // keeps the buckets and nodes for the next scope
+            table.generation = session.generation;
+        }
+        return table;
+    }
+};
+
+}  // namespace detail
+
+///
+/// Directive of the packrat scope, within the memoized results of @ref memoize_directive
+/// are valid. The results are dropped on begin of the next (outermost) scope, hence the
+/// memory is bound by the scope, e.g. the statement.
+///
+template <typename SubjectT>
+struct packrat_scope_directive : x3::unary_parser<SubjectT, packrat_scope_directive<SubjectT>> {
+    using base_type = x3::unary_parser<SubjectT, packrat_scope_directive<SubjectT>>;
+    static bool const is_pass_through_unary = true;
+
+    constexpr packrat_scope_directive(SubjectT const& subject)
+        : base_type(subject)
+    {
+    }
+
+    template <typename IteratorT, typename ContextT, typename RContextT, typename AttributeT>
+    bool parse(IteratorT& first, IteratorT const& last, ContextT const& ctx, RContextT& rctx,
+               AttributeT& attribute) const
+    {
+        auto& session = detail::packrat_session<IteratorT>::instance();
+
+        if (session.depth == 0) {
+            ++session.generation;
+            session.begin = first;
+        }
+
+        struct depth_guard {
+            unsigned& depth;
+            explicit depth_guard(unsigned& depth_)
+                : depth{ ++depth_ }
+            {
+            }
+            ~depth_guard() { --depth; }
+            depth_guard(depth_guard const&) = delete;
+            depth_guard& operator=(depth_guard const&) = delete;
+        } const guard{ session.depth };
+
+        return this->subject.parse(first, last, ctx, rctx, attribute);
+    }
+};
+
+///
+/// Packrat memoization of the subject: A repeated attempt of the subject at the same
+/// position within the @ref packrat_scope_directive reuses the earlier result and end
+/// position. Hence each memoized parser runs at most once per position, which bounds the
+/// backtracking of ordered choices like `physical_literal | abstract_literal` to linear
+/// time.
+///
+/// The subject's result must depend on the position only, not on the context, e.g. the
+/// skipper. Outside of a packrat scope the subject is parsed as is. Failing with exception,
+/// e.g. expectation failure, isn't memoized.
+///
+template <typename SubjectT>
+struct memoize_directive : x3::unary_parser<SubjectT, memoize_directive<SubjectT>> {
+    using base_type = x3::unary_parser<SubjectT, memoize_directive<SubjectT>>;
+    using attribute_type = typename x3::traits::attribute_of<SubjectT, x3::unused_type>::type;
+
+    constexpr memoize_directive(SubjectT const& subject)
+        : base_type(subject)
+    {
+    }
+
+    template <typename IteratorT, typename ContextT, typename RContextT, typename AttributeT>
+    bool parse(IteratorT& first, IteratorT const& last, ContextT const& ctx, RContextT& rctx,
+               AttributeT& attribute) const
+    {
+        auto const& session = detail::packrat_session<IteratorT>::instance();
+
+        if (session.depth == 0) {
+            return this->subject.parse(first, last, ctx, rctx, attribute);
+        }
+
+        using table_type = detail::memo_table<SubjectT, IteratorT, attribute_type>;
+        auto& table = table_type::instance(session);
+
+        auto const key = detail::memo_key{ detail::memo_identity(this->subject),
+                                           std::distance(session.begin, first) };
+
+        if (auto const found = table.entries.find(key); found != table.entries.end()) {
+            packrat_statistics::count_lookup(true);
+            auto const& entry = found->second;
+            if (!entry.success) {
+                return false;
+            }
+            first = entry.last;
+            x3::traits::move_to(attribute_type{ entry.attribute }, attribute);
+            return true;
+        }
+
+        packrat_statistics::count_lookup(false);
+
+        auto iter = first;
+        attribute_type value;
+        bool const parse_ok = this->subject.parse(iter, last, ctx, rctx, value);
+
+        // no iterator into the table is held while parsing, the subject may memoize itself
+        table.entries.emplace(key, detail::memo_entry<IteratorT, attribute_type>{
+                                       parse_ok, iter, parse_ok ? value : attribute_type{} });
+
+        if (!parse_ok) {
+            return false;
+        }
+
+        first = iter;
+        x3::traits::move_to(std::move(value), attribute);
+        return true;
+    }
+};
+
+namespace detail {
+
+struct packrat_scope_gen {
+    template <typename SubjectT>
+    constexpr packrat_scope_directive<typename x3::extension::as_parser<SubjectT>::value_type>
+    operator[](SubjectT const& subject) const
+    {
+        return { x3::as_parser(subject) };
+    }
+};
+
+struct memoize_gen {
+    template <typename SubjectT>
+    constexpr memoize_directive<typename x3::extension::as_parser<SubjectT>::value_type>
+    operator[](SubjectT const& subject) const
+    {
+        return { x3::as_parser(subject) };
+    }
+};
+
+}  // namespace detail
+
+static auto const packrat_scope = detail::packrat_scope_gen{};
+static auto const memoize = detail::memoize_gen{};
+
+}  // namespace parser
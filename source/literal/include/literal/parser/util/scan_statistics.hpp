@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace parser {
+
+///
+/// Counter of the characters inspected by the numeric literal scanners, counted only if
+/// `USE_PARSER_STATISTICS` is defined.
+///
+/// The ratio of inspected to consumed characters shows, that each character of a literal
+/// is inspected O(1) times, i.e. there is no re-scanning by backtracking.
+///
+struct scan_statistics {
+    std::atomic<std::size_t> literals = 0;
+    std::atomic<std::size_t> consumed = 0;
+    std::atomic<std::size_t> inspected = 0;
+
+    double inspections_per_char() const
+    {
+        auto const chars = consumed.load(std::memory_order_relaxed);
+        return chars != 0 ? static_cast<double>(inspected.load(std::memory_order_relaxed)) /
+                                static_cast<double>(chars)
+                          : 0.0;
+    }
+
+    void reset()
+    {
+        literals.store(0, std::memory_order_relaxed);
+        consumed.store(0, std::memory_order_relaxed);
+        inspected.store(0, std::memory_order_relaxed);
+    }
+
+    static scan_statistics& instance()
+    {
+        static scan_statistics stats;
+        return stats;
+    }
+
+    static void count_inspected([[maybe_unused]] std::ptrdiff_t count)
+    {
+#if defined(USE_PARSER_STATISTICS)
+        instance().inspected.fetch_add(static_cast<std::size_t>(count), std::memory_order_relaxed);
+#endif
+    }
+
+    static void count_literal([[maybe_unused]] std::ptrdiff_t length)
+    {
+#if defined(USE_PARSER_STATISTICS)
+        instance().literals.fetch_add(1, std::memory_order_relaxed);
+        instance().consumed.fetch_add(static_cast<std::size_t>(length), std::memory_order_relaxed);
+#endif
+    }
+};
+
+}  // namespace parser
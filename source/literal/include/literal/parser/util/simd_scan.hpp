@@ -0,0 +1,388 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LITERAL_SIMD_SSE2 1
+#endif
+
+// AVX2 is selected at runtime by the CPU features, if it isn't enabled at compile time
+// anyway; the dispatch requires the GCC/Clang target attribute and CPU builtins.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LITERAL_SIMD_AVX2 1
+#elif defined(LITERAL_SIMD_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define LITERAL_SIMD_AVX2 1
+#define LITERAL_SIMD_AVX2_DISPATCH 1
+#endif
+
+#if defined(LITERAL_SIMD_AVX2_DISPATCH)
+#define LITERAL_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define LITERAL_SIMD_TARGET_AVX2
+#endif
+
+namespace parser::simd {
+
+///
+/// Searching of character runs over contiguous memory, by SSE2 in blocks of 16 characters
+/// if available, otherwise (and for the tail) character by character. The character class
+/// runs use AVX2 in blocks of 32 characters, if supported by the CPU at runtime.
+///
+/// All functions return the pointer to the first character found, or `last` if there is
+/// none.
+///
+
+namespace detail {
+
+inline bool is_space(char chr)
+{
+    // same as std::isspace() of the "C" locale: ' ', '\t', '\n', '\v', '\f', '\r'
+    return chr == ' ' || static_cast<unsigned char>(chr - '\t') <= '\r' - '\t';
+}
+
+inline bool is_graphic(char chr)
+{
+    // same as std::isgraph() || std::isspace() of the "C" locale
+    return static_cast<unsigned char>(chr - ' ') <= '~' - ' ' || is_space(chr);
+}
+
+///
+/// The alphanumeric character of the radix, e.g. `[0-9a-fA-F]` of radix 16, or the
+/// underline. The radix 36 is the class of the word characters `[0-9a-zA-Z_]`.
+///
+inline bool is_alnum_or_underline(char chr, unsigned radix)
+{
+    auto const uchr = static_cast<unsigned char>(chr);
+    auto const lower = static_cast<unsigned char>(uchr | 0x20U);  // 'A'...'Z' to lower case
+
+    if (static_cast<unsigned>(uchr - '0') < 10U) {
+        return static_cast<unsigned>(uchr - '0') < radix;
+    }
+    if (static_cast<unsigned>(lower - 'a') < 26U) {
+        return static_cast<unsigned>(lower - 'a') + 10U < radix;
+    }
+    return chr == '_';
+}
+
+/// The last digit and letter of the radix, where the letter is in front of 'a' if the
+/// radix hasn't one.
+struct alnum_range {
+    char digit_last;
+    char letter_last;
+
+    explicit alnum_range(unsigned radix)
+        : digit_last{ static_cast<char>('0' + (radix < 10U ? radix : 10U) - 1U) }
+        , letter_last{ static_cast<char>('a' + (radix > 10U ? radix - 10U : 0U) - 1U) }
+    {
+    }
+
+    bool has_letters() const { return letter_last >= 'a'; }
+};
+
+#if defined(LITERAL_SIMD_SSE2)
+
+static constexpr std::ptrdiff_t block_size = 16;
+
+inline __m128i load(char const* ptr)
+{
+    return _mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr));
+}
+
+/// mask of the characters `first <= chr <= last`, compared as unsigned
+inline __m128i in_range(__m128i chars, char first, char last)
+{
+    auto const offset = _mm_sub_epi8(chars, _mm_set1_epi8(first));
+    auto const limit = _mm_set1_epi8(static_cast<char>(last - first));
+    return _mm_cmpeq_epi8(_mm_min_epu8(offset, limit), offset);
+}
+
+inline __m128i space_mask(__m128i chars)
+{
+    return _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')),
+                        in_range(chars, '\t', '\r'));
+}
+
+inline __m128i graphic_mask(__m128i chars)
+{
+    return _mm_or_si128(in_range(chars, ' ', '~'), in_range(chars, '\t', '\r'));
+}
+
+inline __m128i alnum_or_underline_mask(__m128i chars, alnum_range const& range)
+{
+    auto mask = _mm_or_si128(in_range(chars, '0', range.digit_last),
+                             _mm_cmpeq_epi8(chars, _mm_set1_epi8('_')));
+    if (range.has_letters()) {
+        auto const lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+        mask = _mm_or_si128(mask, in_range(lower, 'a', range.letter_last));
+    }
+    return mask;
+}
+
+inline char const* first_of(char const* block, int mask)
+{
+    return block + std::countr_zero(static_cast<unsigned>(mask));
+}
+
+inline char const* find_not_alnum_or_underline_sse2(char const* first, char const* last,
+                                                    unsigned radix)
+{
+    alnum_range const range{ radix };
+
+    while (last - first >= block_size) {
+        auto const mask =
+            _mm_movemask_epi8(alnum_or_underline_mask(load(first), range)) ^ 0xFFFF;
+        if (mask != 0) {
+            return first_of(first, mask);
+        }
+        first += block_size;
+    }
+
+    while (first != last && is_alnum_or_underline(*first, radix)) {
+        ++first;
+    }
+    return first;
+}
+
+#endif  // LITERAL_SIMD_SSE2
+
+#if defined(LITERAL_SIMD_AVX2)
+
+namespace avx2 {
+
+static constexpr std::ptrdiff_t block_size = 32;
+
+LITERAL_SIMD_TARGET_AVX2 inline __m256i in_range(__m256i chars, char first, char last)
+{
+    auto const offset = _mm256_sub_epi8(chars, _mm256_set1_epi8(first));
+    auto const limit = _mm256_set1_epi8(static_cast<char>(last - first));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(offset, limit), offset);
+}
+
+LITERAL_SIMD_TARGET_AVX2 inline char const* find_not_alnum_or_underline(char const* first,
+                                                                        char const* last,
+                                                                        unsigned radix)
+{
+    alnum_range const range{ radix };
+    auto const underline = _mm256_set1_epi8('_');
+    auto const case_bit = _mm256_set1_epi8(0x20);
+
+    while (last - first >= block_size) {
+        auto const chars = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first));
+        auto mask = _mm256_or_si256(in_range(chars, '0', range.digit_last),
+                                    _mm256_cmpeq_epi8(chars, underline));
+        if (range.has_letters()) {
+            mask = _mm256_or_si256(
+                mask, in_range(_mm256_or_si256(chars, case_bit), 'a', range.letter_last));
+        }
+        auto const found = ~static_cast<unsigned>(_mm256_movemask_epi8(mask));
+        if (found != 0) {
+            return first + std::countr_zero(found);
+        }
+        first += block_size;
+    }
+
+    // the tail of less than a block
+    return find_not_alnum_or_underline_sse2(first, last, radix);
+}
+
+}  // namespace avx2
+
+#endif  // LITERAL_SIMD_AVX2
+
+using find_not_alnum_or_underline_fn = char const* (*)(char const*, char const*, unsigned);
+
+inline char const* find_not_alnum_or_underline_scalar(char const* first, char const* last,
+                                                      unsigned radix)
+{
+    while (first != last && is_alnum_or_underline(*first, radix)) {
+        ++first;
+    }
+    return first;
+}
+
+///
+/// The implementation of the best instruction set supported by the CPU.
+///
+inline find_not_alnum_or_underline_fn select_find_not_alnum_or_underline()
+{
+#if defined(LITERAL_SIMD_AVX2_DISPATCH)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return &avx2::find_not_alnum_or_underline;
+    }
+    return &find_not_alnum_or_underline_sse2;
+#elif defined(LITERAL_SIMD_AVX2)
+    return &avx2::find_not_alnum_or_underline;
+#elif defined(LITERAL_SIMD_SSE2)
+    return &find_not_alnum_or_underline_sse2;
+#else
+    return &find_not_alnum_or_underline_scalar;
+#endif
+}
+
+}  // namespace detail
+
+///
+/// Find the first character, which isn't white space.
+///
+inline char const* find_not_space(char const* first, char const* last)
+{
+#if defined(LITERAL_SIMD_SSE2)
+    using detail::block_size;
+
+    // short runs, e.g. a single blank between tokens, don't pay off a block
+    for (int i = 0; i != 4; ++i) {
+        if (first == last || !detail::is_space(*first)) {
+            return first;
+        }
+        ++first;
+    }
+
+    while (last - first >= block_size) {
+        auto const mask = _mm_movemask_epi8(detail::space_mask(detail::load(first))) ^ 0xFFFF;
+        if (mask != 0) {
+            return detail::first_of(first, mask);
+        }
+        first += block_size;
+    }
+#endif
+
+    while (first != last && detail::is_space(*first)) {
+        ++first;
+    }
+    return first;
+}
+
+///
+/// Find the line end, i.e. '\r' or '\n'.
+///
+inline char const* find_line_end(char const* first, char const* last)
+{
+#if defined(LITERAL_SIMD_SSE2)
+    using detail::block_size;
+
+    auto const cr = _mm_set1_epi8('\r');
+    auto const lf = _mm_set1_epi8('\n');
+
+    while (last - first >= block_size) {
+        auto const chars = detail::load(first);
+        auto const mask = _mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(chars, cr), _mm_cmpeq_epi8(chars, lf)));
+        if (mask != 0) {
+            return detail::first_of(first, mask);
+        }
+        first += block_size;
+    }
+#endif
+
+    while (first != last && *first != '\r' && *first != '\n') {
+        ++first;
+    }
+    return first;
+}
+
+///
+/// Find the delimiter or the first character, which isn't graphic.
+///
+inline char const* find_delimiter_or_non_graphic(char const* first, char const* last, char delim)
+{
+#if defined(LITERAL_SIMD_SSE2)
+    using detail::block_size;
+
+    auto const delimiter = _mm_set1_epi8(delim);
+
+    while (last - first >= block_size) {
+        auto const chars = detail::load(first);
+        auto const mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chars, delimiter)) |
+                          (_mm_movemask_epi8(detail::graphic_mask(chars)) ^ 0xFFFF);
+        if (mask != 0) {
+            return detail::first_of(first, mask);
+        }
+        first += block_size;
+    }
+#endif
+
+    while (first != last && *first != delim && detail::is_graphic(*first)) {
+        ++first;
+    }
+    return first;
+}
+
+///
+/// Find the first character, which is neither alphanumeric of the radix nor the underline,
+/// see @ref detail::is_alnum_or_underline. The instruction set is selected once by the
+/// CPU features.
+///
+inline char const* find_not_alnum_or_underline(char const* first, char const* last,
+                                               unsigned radix)
+{
+    // short runs, e.g. a single digit, don't pay off a block
+    for (int i = 0; i != 4; ++i) {
+        if (first == last || !detail::is_alnum_or_underline(*first, radix)) {
+            return first;
+        }
+        ++first;
+    }
+
+    static auto const find = detail::select_find_not_alnum_or_underline();
+    return find(first, last, radix);
+}
+
+///
+/// Scan the delimited digits `digit { [ '_' ] digit }` of the radix, i.e. the run of
+/// digits and underlines, where each underline must be followed by a digit.
+///
+/// @return The pointer behind the digits, which is `first` if there is none.
+///
+inline char const* scan_delimited_digits(char const* first, char const* last, unsigned radix)
+{
+    if (first == last || *first == '_' || !detail::is_alnum_or_underline(*first, radix)) {
+        return first;
+    }
+
+    auto const* const run_last = find_not_alnum_or_underline(first + 1, last, radix);
+
+    // the delimiters are rare, hence searched by memchr() within the run
+    auto const* iter = first + 1;
+    while (auto const* delim = static_cast<char const*>(
+               std::memchr(iter, '_', static_cast<std::size_t>(run_last - iter)))) {
+        if (delim + 1 == run_last || delim[1] == '_') {
+            return delim;
+        }
+        iter = delim + 2;
+    }
+    return run_last;
+}
+
+///
+/// Find the two character sequence, e.g. the end of a block comment "*/".
+///
+inline char const* find_pair(char const* first, char const* last, char chr1, char chr2)
+{
+    while (last - first >= 2) {
+        // memchr() is vectorized by the C library
+        auto const* found = static_cast<char const*>(
+            std::memchr(first, chr1, static_cast<std::size_t>(last - first - 1)));
+        if (found == nullptr) {
+            return last;
+        }
+        if (found[1] == chr2) {
+            return found;
+        }
+        first = found + 1;
+    }
+    return last;
+}
+
+}  // namespace parser::simd
@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+#include <system_error>
+
+namespace util {
+
+///
+/// The failure of a memoized computation.
+///
+struct memo_failure {
+    std::error_code ec;
+    /// name of the failed API function, if known; must be of static storage duration
+    char const* api_function = nullptr;
+};
+
+///
+/// A value, which is computed on first access and cached afterwards - including the
+/// failure of the computation.
+///
+/// The interface mimics `std::optional<T>`, so that a value can be assigned directly, e.g.
+/// by the parser. Concurrent readers of @ref get_or_compute are safe; only one of them
+/// computes the value, the others wait for. Assignment isn't synchronized with readers.
+///
+/// @note Copies are taken as of the current state; a copy of a value in computation is
+/// empty.
+///
+template <typename T>
+class memoized_value {
+public:
+    using value_type = T;
+
+public:
+    memoized_value() = default;
+    ~memoized_value() = default;
+
+    memoized_value(memoized_value const& other) { copy_from(other); }
+
+    memoized_value& operator=(memoized_value const& other)
+    {
+        if (this != &other) {
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    memoized_value& operator=(T const& value)
+    {
+        the_value = value;
+        state.store(READY, std::memory_order_release);
+        return *this;
+    }
+
+    bool has_value() const { return state.load(std::memory_order_acquire) == READY; }
+
+    explicit operator bool() const { return has_value(); }
+
+    T const& value() const
+    {
+        if (!has_value()) {
+            throw std::logic_error("memoized_value: access to empty value");
+        }
+        return the_value;
+    }
+
+    T const& operator*() const
+    {
+        assert(has_value() && "access to empty value");
+        return the_value;
+    }
+
+    T value_or(T const& default_value) const
+    {
+        return has_value() ? the_value : default_value;
+    }
+
+    ///
+    /// Get the cached value or the cached failure. The value is computed by the first
+    /// caller, concurrent callers wait until it's done.
+    ///
+    /// @param compute Callable with signature `memo_failure(T&)`, which mustn't throw.
+    /// @return Pointer to the failure, or nullptr if the value is available.
+    ///
+    template <typename ComputeF>
+    memo_failure const* get_or_compute(ComputeF&& compute) const
+    {
+        auto current = state.load(std::memory_order_acquire);
+
+        if (current == EMPTY &&
+            state.compare_exchange_strong(current, BUSY, std::memory_order_acq_rel)) {
+            failure = compute(the_value);
+            current = failure.ec ? FAILED : READY;
+            state.store(current, std::memory_order_release);
+            state.notify_all();
+        }
+
+        while (current == BUSY) {
+            state.wait(BUSY, std::memory_order_acquire);
+            current = state.load(std::memory_order_acquire);
+        }
+
+        return (current == FAILED) ? &failure : nullptr;
+    }
+
+private:
+    void copy_from(memoized_value const& other)
+    {
+        auto const other_state = other.state.load(std::memory_order_acquire);
+        if (other_state == READY || other_state == FAILED) {
+            the_value = other.the_value;
+            failure = other.failure;
+            state.store(other_state, std::memory_order_release);
+        }
+        else {
+            state.store(EMPTY, std::memory_order_release);
+        }
+    }
+
+private:
+    enum : std::uint8_t { EMPTY, BUSY, READY, FAILED };
+
+    mutable std::atomic<std::uint8_t> state = EMPTY;
+    mutable T the_value{};
+    mutable memo_failure failure;
+};
+
+}  // namespace util
@@ -0,0 +1,272 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <literal/convert/convert.hpp>
+#include <literal/convert/detail/based_real.hpp>
+#include <literal/convert/leaf_errors.hpp>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <boost/leaf/exception.hpp>
+#include <boost/leaf/common.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>  // log2
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <system_error>
+
+namespace convert::detail {
+
+namespace {
+
+namespace mp = boost::multiprecision;
+
+using big_int = mp::cpp_int;
+
+/// The binary exponent bound beyond any value representable by the supported real types.
+std::int64_t constexpr binary_exponent_bound = std::int64_t{ 1 } << 16;
+
+std::uint64_t constexpr msb_mask = std::uint64_t{ 1 } << 63;
+
+[[noreturn]] void throw_invalid_argument(char const* api_name, char const* where)
+{
+    auto const ec = std::make_error_code(std::errc::invalid_argument);
+    throw leaf::exception(ec, leaf::e_api_function{ api_name },
+                          leaf::e_position_iterator{ where });
+}
+
+///
+/// Accumulate digits exactly into a big integer. As many digits as possible are gathered
+/// into a machine word first, so that the costly big integer multiplication is done only
+/// once per chunk of digits.
+///
+class digit_accumulator {
+public:
+    explicit digit_accumulator(unsigned base_)
+        : base{ base_ }
+        , chunk_scale_limit{ std::numeric_limits<std::uint64_t>::max() / base_ }
+    {
+    }
+
+    void push(std::uint64_t digit)
+    {
+        if (chunk_scale > chunk_scale_limit) {
+            flush();
+        }
+        chunk = chunk * base + digit;
+        chunk_scale *= base;
+    }
+
+    big_int const& value()
+    {
+        flush();
+        return accu;
+    }
+
+private:
+    void flush()
+    {
+        if (chunk_scale != 1) {
+            accu *= chunk_scale;
+            accu += chunk;
+            chunk = 0;
+            chunk_scale = 1;
+        }
+    }
+
+private:
+    std::uint64_t const base;
+    std::uint64_t const chunk_scale_limit;
+    std::uint64_t chunk = 0;
+    std::uint64_t chunk_scale = 1;
+    big_int accu = 0;
+};
+
+///
+/// The upper 64 bits of the big integer as normalized binary mantissa.
+///
+binary_mantissa top_bits(big_int const& value, std::int64_t exponent, bool sticky)
+{
+    static std::int64_t constexpr word_bits = 64;
+
+    auto const width = static_cast<std::int64_t>(mp::msb(value)) + 1;
+    auto const shift = width - word_bits;
+
+    if (shift <= 0) {
+        // normalize, so that the MSB is set
+        auto const mantissa = static_cast<std::uint64_t>(value) << -shift;
+        return { mantissa, exponent + shift, sticky };
+    }
+
+    sticky = sticky || static_cast<std::int64_t>(mp::lsb(value)) < shift;
+    auto const mantissa = static_cast<std::uint64_t>(value >> static_cast<unsigned>(shift));
+
+    return { mantissa, exponent + shift, sticky };
+}
+
+///
+/// The binary mantissa of `digits * base^scale`, computed exactly.
+///
+binary_mantissa scaled_mantissa(big_int const& digits, unsigned base, std::int64_t scale)
+{
+    // Cheap estimate of the binary magnitude, to avoid big integer arithmetic with
+    // absurd exponents. The value is replaced by one, which is safely out of range.
+    auto const magnitude = static_cast<double>(mp::msb(digits)) +
+                           static_cast<double>(scale) * std::log2(static_cast<double>(base));
+
+    if (magnitude > static_cast<double>(binary_exponent_bound)) {
+        return { msb_mask, binary_exponent_bound, false };
+    }
+    if (magnitude < -static_cast<double>(binary_exponent_bound)) {
+        return { msb_mask, -2 * binary_exponent_bound, true };
+    }
+
+    // Note: don't use `auto` with boost.multiprecision, which results into dangling
+    // references by the expression templates.
+    big_int const big_base = base;
+
+    if (scale >= 0) {
+        big_int const value = digits * mp::pow(big_base, static_cast<unsigned>(scale));
+        return top_bits(value, 0, false);
+    }
+
+    // value = digits / base^-scale; scale the dividend, so that the quotient has at least
+    // 64 significant bits. The remainder goes into the sticky bit.
+    big_int const divisor = mp::pow(big_base, static_cast<unsigned>(-scale));
+    auto const shift = std::max<std::int64_t>(
+        0, 64 - static_cast<std::int64_t>(mp::msb(digits)) +
+               static_cast<std::int64_t>(mp::msb(divisor)));
+
+    big_int quotient;
+    big_int remainder;
+    big_int const dividend = digits << static_cast<unsigned>(shift);
+    mp::divide_qr(dividend, divisor, quotient, remainder);
+
+    return top_bits(quotient, -shift, !remainder.is_zero());
+}
+
+}  // namespace
+
+binary_mantissa based_real_mantissa(unsigned base, std::string_view integer,
+                                    std::string_view fractional, std::string_view exponent)
+{
+    LEAF_ERROR_TRACE;
+
+    static auto constexpr api_name = "based_real_mantissa";
+
+    assert((2 <= base && base <= 36) && "Base must be in range [2, 36]");
+
+    digit_accumulator accumulator{ base };
+    std::int64_t fractional_count = 0;
+
+    auto const accumulate = [&](std::string_view digits) {
+        std::int64_t count = 0;
+        for (char const& chr : digits) {
+            if (chr == '_') {
+                continue;
+            }
+            auto const digit = chr2dec(chr);
+            if (!(digit < base)) {
+                throw_invalid_argument(api_name, &chr);
+            }
+            accumulator.push(digit);
+            ++count;
+        }
+        return count;
+    };
+
+    accumulate(integer);
+    fractional_count = accumulate(fractional);
+
+    big_int const& digits = accumulator.value();
+
+    if (digits.is_zero()) {
+        return {};
+    }
+
+    // LEAF
+    std::int64_t const scale = real_exponent_value(exponent) - fractional_count;
+
+    return scaled_mantissa(digits, base, scale);
+}
+
+binary_mantissa pow2_real_mantissa(unsigned base, std::string_view integer,
+                                   std::string_view fractional, std::string_view exponent)
+{
+    LEAF_ERROR_TRACE;
+
+    static auto constexpr api_name = "pow2_real_mantissa";
+    static std::int64_t constexpr word_bits = 64;
+
+    assert((2 <= base && base <= 32 && std::has_single_bit(base)) &&
+           "Base must be a power of two in range [2, 32]");
+
+    auto const bits = static_cast<unsigned>(std::countr_zero(base));
+
+    std::uint64_t mantissa = 0;
+    std::int64_t binary_exponent = 0;
+    bool sticky = false;
+    // once a digit doesn't fit anymore, all following digits are beyond the mantissa
+    bool full = false;
+
+    // Digits are packed into the mantissa directly, the position of the digit determines
+    // the binary exponent, only, hence no multiplication is involved.
+    auto const pack = [&](std::string_view digits, bool is_fractional) {
+        for (char const& chr : digits) {
+            if (chr == '_') {
+                continue;
+            }
+            auto const digit = chr2dec(chr);
+            if (!(digit < base)) {
+                throw_invalid_argument(api_name, &chr);
+            }
+            full = full || (mantissa >> (word_bits - bits)) != 0;
+            if (!full) {
+                mantissa = (mantissa << bits) | digit;
+                if (is_fractional) {
+                    binary_exponent -= bits;
+                }
+            }
+            else {
+                sticky = sticky || digit != 0;
+                if (!is_fractional) {
+                    binary_exponent += bits;
+                }
+            }
+        }
+    };
+
+    pack(integer, false);
+    pack(fractional, true);
+
+    if (mantissa == 0) {
+        return {};
+    }
+
+    // normalize, so that the MSB is set
+    auto const shift = std::countl_zero(mantissa);
+    mantissa <<= shift;
+    binary_exponent -= shift;
+
+    // LEAF; base^exp = 2^(bits * exp), the saturated exponent value can't overflow here
+    binary_exponent += static_cast<std::int64_t>(bits) * real_exponent_value(exponent);
+
+    return { mantissa, binary_exponent, sticky };
+}
+
+binary_mantissa power_mantissa(unsigned base, std::int64_t exponent)
+{
+    LEAF_ERROR_TRACE;
+
+    assert((2 <= base && base <= 36) && "Base must be in range [2, 36]");
+
+    return scaled_mantissa(big_int{ 1 }, base, exponent);
+}
+
+}  // namespace convert::detail
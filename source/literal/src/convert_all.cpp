@@ -0,0 +1,209 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <literal/convert/convert_all.hpp>
+#include <literal/convert/convert.hpp>
+#include <literal/convert/physical_unit.hpp>
+#include <literal/convert/leaf_errors.hpp>
+#include <literal/util/overloaded.hpp>
+
+#include <boost/leaf.hpp>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <thread>
+#include <variant>
+
+namespace convert {
+
+namespace leaf = boost::leaf;
+
+namespace {
+
+using node_pointer = std::variant<ast::integer_type*, ast::real_type*,
+                                  ast::bit_string_literal*, ast::physical_literal*>;
+
+struct work_item {
+    node_pointer node;
+    unsigned base;
+    std::size_t index;
+};
+
+/// minimal count of literals per thread, below the thread's overhead dominates
+std::size_t constexpr min_parallel_chunk = 4096;
+
+///
+/// A standalone unit name, e.g. 'ns', has a default constructed abstract literal without
+/// a base, there is nothing to convert.
+///
+bool is_standalone_unit(ast::physical_literal const& physical)
+{
+    return boost::apply_visitor(
+        [](auto const& abstract) {
+            return boost::apply_visitor([](auto const& node) { return node.base == 0; },
+                                        abstract.num);
+        },
+        physical.literal);
+}
+
+///
+/// Walk the literal tree once and gather the numeric nodes.
+///
+std::vector<work_item> gather(ast::literals& literals)
+{
+    std::vector<work_item> work;
+    work.reserve(literals.size());
+
+    std::size_t index = 0;
+
+    auto const add_num = [&](auto& num) {
+        boost::apply_visitor(
+            [&](auto& node) {
+                work.push_back({ &node, node.base, index });
+            },
+            num);
+    };
+
+    auto const add_abstract = [&](ast::abstract_literal& abstract) {
+        boost::apply_visitor(util::overloaded{
+            [&](ast::based_literal& literal) { add_num(literal.num); },
+            [&](ast::decimal_literal& literal) { add_num(literal.num); }
+        }, abstract);
+    };
+
+    for (auto& literal : literals) {
+        boost::apply_visitor(util::overloaded{
+            [&](ast::numeric_literal& numeric) {
+                boost::apply_visitor(util::overloaded{
+                    [&](ast::abstract_literal& abstract) { add_abstract(abstract); },
+                    [&](ast::physical_literal& physical) {
+                        if (!is_standalone_unit(physical)) {
+                            add_abstract(physical.literal);
+                        }
+                        work.push_back({ &physical, 0, index });
+                    }
+                }, numeric);
+            },
+            [&](ast::bit_string_literal& bit_string) {
+                work.push_back({ &bit_string, bit_string.base, index });
+            },
+            [](auto&) { /* nothing to convert */ }
+        }, literal);
+        ++index;
+    }
+
+    // group by kind and base
+    std::ranges::stable_sort(work, [](work_item const& lhs, work_item const& rhs) {
+        return std::pair{ lhs.node.index(), lhs.base } < std::pair{ rhs.node.index(), rhs.base };
+    });
+
+    return work;
+}
+
+std::optional<conversion_failure> convert_item(work_item const& item, unit_table const& units)
+{
+    return leaf::try_catch(
+        [&]() -> std::optional<conversion_failure> {
+            // LEAF; the node's memoized value is used, if it's already converted
+            std::visit(util::overloaded{
+                [&](ast::physical_literal* node) {
+                    node->value = convert::physical_literal(*node, units);
+                },
+                [](auto* node) { ast::value_of(*node); }
+            }, item.node);
+            return std::nullopt;
+        },
+        [&](std::error_code const& ec,
+            leaf::e_api_function const* api_fcn) -> std::optional<conversion_failure> {
+            auto message = api_fcn
+                ? fmt::format("Error in API function '{}': {}", api_fcn->value, ec.message())
+                : ec.message();
+            return conversion_failure{ item.index, ec, std::move(message) };
+        },
+        [&](std::exception const& e) -> std::optional<conversion_failure> {
+            auto const ec = std::make_error_code(std::errc::invalid_argument);
+            return conversion_failure{ item.index, ec, e.what() };
+        });
+}
+
+void convert_range(std::span<work_item const> work, unit_table const& units,
+                   std::vector<conversion_failure>& failures)
+{
+    for (auto const& item : work) {
+        if (auto failure = convert_item(item, units); failure) {
+            failures.push_back(std::move(*failure));
+        }
+    }
+}
+
+void convert_parallel(std::span<work_item const> work, std::size_t thread_count,
+                      unit_table const& units, std::vector<conversion_failure>& failures)
+{
+    // Each thread converts a contiguous chunk, hence the grouping is kept. The items aren't
+    // independent: a physical literal and its nested abstract literal may land in different
+    // chunks, both touch the nested node. The physical literal's conversion reads the
+    // nested spelling only, while the other thread memoizes the nested node's value. This
+    // is safe since the value is a util::memoized_value, which is published by its atomic
+    // EMPTY/BUSY/READY state; it mustn't be replaced by a plain std::optional. Beside of
+    // this, the only state are the per thread failure lists.
+    std::vector<std::vector<conversion_failure>> thread_failures(thread_count);
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(thread_count);
+
+        auto const chunk_size = (work.size() + thread_count - 1) / thread_count;
+
+        for (std::size_t i = 0; i != thread_count; ++i) {
+            auto const offset = std::min(i * chunk_size, work.size());
+            auto const chunk = work.subspan(offset, std::min(chunk_size, work.size() - offset));
+            threads.emplace_back([chunk, &units, &result = thread_failures[i]] {
+                convert_range(chunk, units, result);
+            });
+        }
+    }  // join
+
+    for (auto& list : thread_failures) {
+        std::ranges::move(list, std::back_inserter(failures));
+    }
+}
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os, conversion_failure const& failure)
+{
+    fmt::print(os, "literal #{}: {}", failure.index, failure.message);
+    return os;
+}
+
+std::vector<conversion_failure> convert_all(ast::literals& literals, convert_mode mode,
+                                            unit_table const& units)
+{
+    auto const work = gather(literals);
+
+    std::vector<conversion_failure> failures;
+
+    auto const thread_count = std::min<std::size_t>(
+        std::max(1U, std::thread::hardware_concurrency()), work.size() / min_parallel_chunk);
+
+    if (mode == convert_mode::sequential || thread_count < 2) {
+        convert_range(work, units, failures);
+    }
+    else {
+        convert_parallel(work, thread_count, units, failures);
+    }
+
+    // the work was grouped, restore the literal's order
+    std::ranges::sort(failures, {}, &conversion_failure::index);
+
+    return failures;
+}
+
+}  // namespace convert
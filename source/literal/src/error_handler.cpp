@@ -31,7 +31,7 @@ error_recovery_common_strategy::call(iterator_type& first, iterator_type last,
     auto const symbol = recovery_aux.symbol;
 
     if constexpr(verbose_error_handler) {
-        static auto const find_grammar = x3::skip(x3::space | parser::comment)[
+        static auto const find_grammar = x3::skip(parser::skipper)[
             x3::lexeme[ +(x3::char_ - symbol) >> x3::char_(symbol) ]
         ];
         os << fmt::format("+++ recover in: |{} ...|\n", excerpt_sv(first, last));
@@ -42,7 +42,7 @@ error_recovery_common_strategy::call(iterator_type& first, iterator_type last,
         }
     }
     else {
-        static auto const find_grammar = x3::skip(x3::space | parser::comment)[
+        static auto const find_grammar = x3::skip(parser::skipper)[
             +(x3::char_ - symbol) >> symbol
         ];
         if(x3::parse(first, last, find_grammar)) {
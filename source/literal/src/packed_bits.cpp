@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <literal/convert/convert.hpp>
+#include <literal/convert/packed_bits.hpp>
+#include <literal/convert/leaf_errors.hpp>
+
+#include <boost/leaf/exception.hpp>
+#include <boost/leaf/common.hpp>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>  // memcpy
+#include <string_view>
+#include <system_error>
+#include <iostream>
+
+namespace convert {
+
+namespace leaf = boost::leaf;
+
+namespace detail {
+
+namespace {
+
+/// log2 of a power of two base, 0 otherwise
+unsigned bits_per_digit(unsigned base)
+{
+    if (base < 2 || base > 32 || !std::has_single_bit(base)) {
+        return 0;
+    }
+    return static_cast<unsigned>(std::countr_zero(base));
+}
+
+std::uint64_t byte_swap(std::uint64_t value)
+{
+    // recognized by GCC, Clang and MSVC as bswap
+    value = ((value & 0x00FF00FF00FF00FFULL) << 8) | ((value >> 8) & 0x00FF00FF00FF00FFULL);
+    value = ((value & 0x0000FFFF0000FFFFULL) << 16) | ((value >> 16) & 0x0000FFFF0000FFFFULL);
+    return (value << 32) | (value >> 32);
+}
+
+///
+/// Decode 8 hexadecimal ASCII digits at once (SWAR), the first character is the most
+/// significant nibble. Fails if any of the characters isn't a hexadecimal digit, which
+/// includes the delimiter '_'.
+///
+/// Concept: All bytes are checked for being in range ['0', '9'] or, case folded, in
+/// range ['a', 'f'] by adding a bias, so that the MSB of the byte gets set if the
+/// lower bound is reached and doesn't get set if the upper bound is exceeded. Since
+/// all bytes are 7-bit ASCII, there is no carry into the neighbor byte.
+///
+/// @note Little endian targets only, the caller is responsible for.
+///
+bool swar_hex8(char const* chars, std::uint32_t& value)
+{
+    static constexpr std::uint64_t ones = 0x0101010101010101ULL;
+    static constexpr std::uint64_t msb = ones * 0x80;
+
+    auto const in_range = [](std::uint64_t x, unsigned lo, unsigned hi) {
+        return (x + ones * (0x80 - lo)) & ~(x + ones * (0x7F - hi)) & msb;
+    };
+
+    std::uint64_t chunk;
+    std::memcpy(&chunk, chars, sizeof(chunk));
+
+    if ((chunk & msb) != 0) {
+        return false;
+    }
+
+    auto const lower = chunk | (ones * 0x20);
+    if ((in_range(chunk, '0', '9') | in_range(lower, 'a', 'f')) != msb) {
+        return false;
+    }
+
+    // nibble value of the digit, letters [a-fA-F] do have bit 0x40 set and get 9 added
+    auto const letter = (chunk & (ones * 0x40)) >> 6;
+    auto nibbles = (chunk & (ones * 0x0F)) + (letter << 3) + letter;
+
+    // the first character is the lowest byte, but the most significant nibble
+    nibbles = byte_swap(nibbles);
+    nibbles = (nibbles | (nibbles >> 4)) & 0x00FF00FF00FF00FFULL;
+    nibbles = (nibbles | (nibbles >> 8)) & 0x0000FFFF0000FFFFULL;
+    nibbles = (nibbles | (nibbles >> 16)) & 0x00000000FFFFFFFFULL;
+
+    value = static_cast<std::uint32_t>(nibbles);
+    return true;
+}
+
+}  // namespace
+
+packed_bits decode_packed_bits(unsigned base, std::string_view literal,
+                               packed_bits::allocator_type const& alloc)
+{
+    LEAF_ERROR_TRACE;
+
+    auto const bits = bits_per_digit(base);
+
+    if (bits == 0) {
+        auto const ec = std::make_error_code(std::errc::not_supported);
+        throw leaf::exception(ec, leaf::e_api_function{ "decode_packed_bits" });
+    }
+
+    auto const digit_count =
+        literal.size() - static_cast<std::size_t>(std::ranges::count(literal, '_'));
+
+    packed_bits result(alloc);
+    result.bit_length = digit_count * bits;
+    result.words.assign(packed_bits::words_for(result.bit_length), 0);
+
+    std::size_t pos = 0;
+
+    auto const deposit = [&](std::uint64_t value, unsigned width) {
+        auto const idx = pos / packed_bits::word_bits;
+        auto const offset = pos % packed_bits::word_bits;
+        result.words[idx] |= value << offset;
+        if (offset + width > packed_bits::word_bits) {
+            result.words[idx + 1] |= value >> (packed_bits::word_bits - offset);
+        }
+        pos += width;
+    };
+
+    // digits are processed from the least significant (last) one
+    char const* const begin = literal.data();
+    char const* ptr = begin + literal.size();
+
+    while (ptr != begin) {
+        if constexpr (std::endian::native == std::endian::little) {
+            std::uint32_t value;
+            if (bits == 4 && (ptr - begin) >= 8 && swar_hex8(ptr - 8, value)) {
+                deposit(value, 32);
+                ptr -= 8;
+                continue;
+            }
+        }
+
+        char const chr = *--ptr;
+
+        if (chr == '_') {
+            continue;
+        }
+
+        auto const digit = chr2dec(chr);
+
+        if (!(digit < base)) {
+            auto const ec = std::make_error_code(std::errc::invalid_argument);
+            throw leaf::exception(ec, leaf::e_api_function{ "decode_packed_bits" },
+                                  leaf::e_position_iterator{ ptr });
+        }
+
+        deposit(digit, bits);
+    }
+
+    return result;
+}
+
+}  // namespace detail
+
+bool operator==(packed_bits const& lhs, packed_bits const& rhs)
+{
+    return lhs.bit_length == rhs.bit_length && std::ranges::equal(lhs.words, rhs.words);
+}
+
+std::ostream& operator<<(std::ostream& os, packed_bits const& bits)
+{
+    static constexpr std::size_t nibble_bits = 4;
+
+    auto const nibble_count = (bits.bit_length + nibble_bits - 1) / nibble_bits;
+
+    fmt::print(os, R"({}x")", bits.bit_length);
+    for (auto i = nibble_count; i-- != 0;) {
+        auto const pos = i * nibble_bits;
+        auto const nibble = bits.words[pos / packed_bits::word_bits] >> (pos % packed_bits::word_bits);
+        // a nibble never straddles a word boundary, since 64 is a multiple of 4
+        fmt::print(os, "{:X}", nibble & 0xF);
+    }
+    fmt::print(os, R"(")");
+
+    return os;
+}
+
+}  // namespace convert
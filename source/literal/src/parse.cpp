@@ -1,11 +1,54 @@
 #include <literal/parse.hpp>
 #include <literal/parser/literal.hpp>
+#include <literal/parser/literal_scanner.hpp>
 
 #include <fmt/format.h>
 
 #include <iostream>
 
-bool parse(std::string const& input, ast::literals& literals, std::ostream& os) {
+namespace {
+
+///
+/// The fast path: Scan the statements, unrecognized ones are handed to the X3 grammar,
+/// which reports the errors and recovers from them. Same as `*literal_rule`, the
+/// parser stops at the first statement, which can't be parsed by both.
+///
+template <typename IteratorT, typename ErrorHandlerT>
+void scan_statements(IteratorT& iter, IteratorT const& end, ErrorHandlerT& error_handler,
+                     ast::literals& literals)
+{
+    auto const statement = x3::with<x3::error_handler_tag>(error_handler)[
+        x3::skip(parser::skipper)[ parser::literal_rule ]
+    ];
+
+    auto const max_length = parser::parse_limits::current().max_statement_length;
+
+    for (;;) {
+        ast::literal literal;
+
+        // statements exceeding the limit are left to the X3 grammar to be reported
+        auto const statement_first = iter;
+        if (parser::scan_literal_statement(iter, end, literal) &&
+            static_cast<std::size_t>(std::distance(statement_first, iter)) <= max_length) {
+            literals.push_back(std::move(literal));
+            continue;
+        }
+        iter = statement_first;
+
+        parser::literal_scanner::skip(iter, end);
+        if (iter == end || !x3::parse(iter, end, statement, literal)) {
+            return;
+        }
+        literals.push_back(std::move(literal));
+    }
+}
+
+}  // namespace
+
+bool parse(std::string const& input, ast::literals& literals, std::ostream& os, parse_mode mode,
+           parser::parse_limits const& limits) {
+
+    parser::parse_limits_scope const limits_scope(limits);
 
     try {
         auto iter = input.begin();
@@ -17,7 +60,14 @@ bool parse(std::string const& input, ast::literals& literals, std::ostream& os)
             parser::grammar >> -x3::eoi
         ];
 
-        bool parse_ok = x3::parse(iter, end, grammar, literals);
+        bool parse_ok = true;
+
+        if (mode == parse_mode::fast_scan) {
+            scan_statements(iter, end, error_handler, literals);
+        }
+        else {
+            parse_ok = x3::parse(iter, end, grammar, literals);
+        }
 
         os << fmt::format("parse success: {}, {} error(s)\n", parse_ok, parser::error_count);
 #if 0
@@ -0,0 +1,240 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <literal/convert/physical_unit.hpp>
+#include <literal/convert/convert.hpp>
+#include <literal/convert/detail/int_types.hpp>
+#include <literal/convert/leaf_errors.hpp>
+#include <literal/util/overloaded.hpp>
+
+#include <boost/leaf/exception.hpp>
+#include <boost/leaf/common.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <system_error>
+
+namespace convert {
+
+namespace leaf = boost::leaf;
+
+namespace {
+
+using uint128_t = nostd::uint128_t;
+
+std::uint64_t constexpr count_max = std::numeric_limits<std::int64_t>::max();
+
+[[noreturn]] void throw_error(std::errc errc, char const* api_name)
+{
+    throw leaf::exception(std::make_error_code(errc), leaf::e_api_function{ api_name });
+}
+
+std::int64_t checked_count(uint128_t count)
+{
+    if (count > count_max) {
+        throw_error(std::errc::result_out_of_range, "physical_literal");
+    }
+    return static_cast<std::int64_t>(count);
+}
+
+/// Round `value / divisor` to nearest, ties to even. The sticky flag tells, that the
+/// dividend is slightly larger than the value.
+uint128_t rounded_quotient(uint128_t value, uint128_t divisor, bool sticky)
+{
+    auto quotient = value / divisor;
+    auto const twice_remainder = 2 * (value % divisor);
+
+    if (twice_remainder > divisor ||
+        (twice_remainder == divisor && (sticky || (quotient & 1) != 0))) {
+        ++quotient;
+    }
+    return quotient;
+}
+
+///
+/// Exact: `digits * 10^scale * unit_scale`
+///
+std::int64_t scaled_count(detail::decimal_significand const& significand,
+                          std::int64_t unit_scale)
+{
+    // 38 decimal digits fit into 128 bit
+    static std::int64_t constexpr max_pow10 = 38;
+
+    // < 2^64 * 2^63
+    uint128_t count = uint128_t{ significand.digits } * static_cast<std::uint64_t>(unit_scale);
+
+    if (count == 0) {
+        return 0;
+    }
+
+    if (significand.scale >= 0) {
+        for (std::int64_t i = 0; i != significand.scale; ++i) {
+            if (count > count_max) {
+                break;
+            }
+            count *= 10;
+        }
+        // LEAF
+        return checked_count(count);
+    }
+
+    if (-significand.scale > max_pow10) {
+        // count < 2^127 < 0.5 * 10^39
+        return 0;
+    }
+
+    uint128_t divisor = 1;
+    for (std::int64_t i = 0; i != -significand.scale; ++i) {
+        divisor *= 10;
+    }
+
+    // LEAF
+    return checked_count(rounded_quotient(count, divisor, false));
+}
+
+///
+/// Rounded by the mantissa's accuracy: `mantissa * 2^exponent * unit_scale`
+///
+std::int64_t scaled_count(detail::binary_mantissa const& mantissa, std::int64_t unit_scale)
+{
+    static std::int64_t constexpr word_bits = 128;
+
+    if (mantissa.value == 0) {
+        return 0;
+    }
+
+    // < 2^64 * 2^63
+    uint128_t const count = uint128_t{ mantissa.value } * static_cast<std::uint64_t>(unit_scale);
+
+    if (mantissa.exponent >= 0) {
+        if (mantissa.exponent >= 64 || count > (uint128_t{ count_max } >> mantissa.exponent)) {
+            throw_error(std::errc::result_out_of_range, "physical_literal");
+        }
+        return checked_count(count << mantissa.exponent);
+    }
+
+    if (-mantissa.exponent >= word_bits) {
+        // count < 2^127, hence less than half of the divisor
+        return 0;
+    }
+
+    auto const divisor = uint128_t{ 1 } << static_cast<unsigned>(-mantissa.exponent);
+
+    // LEAF
+    return checked_count(rounded_quotient(count, divisor, mantissa.sticky));
+}
+
+std::int64_t scaled_count(ast::integer_type const& int_, std::int64_t unit_scale)
+{
+    // LEAF
+    auto const magnitude = detail::integer_value<std::uint64_t>(int_.base, int_.integer,
+                                                                int_.exponent);
+    // LEAF
+    auto const count = util::mul<std::uint64_t>(magnitude, static_cast<std::uint64_t>(unit_scale));
+
+    // LEAF
+    return checked_count(count);
+}
+
+std::int64_t scaled_count(ast::real_type const& real, std::int64_t unit_scale)
+{
+    if (real.base == 0) {
+        // standalone unit name, the abstract literal is default constructed
+        return unit_scale;
+    }
+
+    if (real.base == 10U) {
+        // LEAF
+        auto const significand =
+            detail::scan_decimal_real(real.integer, real.fractional, real.exponent);
+        if (!significand.truncated) {
+            // LEAF
+            return scaled_count(significand, unit_scale);
+        }
+    }
+
+    // LEAF
+    auto const mantissa =
+        std::has_single_bit(real.base)
+            ? detail::pow2_real_mantissa(real.base, real.integer, real.fractional, real.exponent)
+            : detail::based_real_mantissa(real.base, real.integer, real.fractional,
+                                          real.exponent);
+
+    // LEAF
+    return scaled_count(mantissa, unit_scale);
+}
+
+}  // namespace
+
+void unit_table::add(std::string_view name, std::int64_t multiplier, std::string_view unit_name)
+{
+    LEAF_ERROR_TRACE;
+
+    static auto constexpr api_name = "unit_table::add";
+
+    if (scale_of(name) || multiplier < 1) {
+        throw_error(std::errc::invalid_argument, api_name);
+    }
+
+    auto const unit_scale = scale_of(unit_name);
+
+    if (!unit_scale) {
+        throw_error(std::errc::invalid_argument, api_name);
+    }
+
+    if (multiplier > std::numeric_limits<std::int64_t>::max() / *unit_scale) {
+        throw_error(std::errc::result_out_of_range, api_name);
+    }
+
+    user_units.push_back({ std::string{ name }, multiplier * *unit_scale });
+}
+
+std::optional<std::int64_t> unit_table::scale_of(std::string_view name) const
+{
+    if (auto const scale = time_unit_scale(name); scale) {
+        return scale;
+    }
+
+    auto const iter = std::ranges::find_if(user_units, [name](user_unit const& unit) {
+        return detail::unit_name_equal(unit.name, name);
+    });
+
+    if (iter != user_units.end()) {
+        return iter->scale;
+    }
+
+    return std::nullopt;
+}
+
+std::int64_t convert_physical_literal::operator()(ast::physical_literal const& literal,
+                                                  unit_table const& units) const
+{
+    LEAF_ERROR_TRACE;
+
+    auto const unit_scale = units.scale_of(literal.unit_name);
+
+    if (!unit_scale) {
+        throw_error(std::errc::invalid_argument, "physical_literal");
+    }
+
+    auto const count_of = [&](auto const& abstract) {
+        return boost::apply_visitor(
+            [&](auto const& node) {
+                // LEAF
+                return scaled_count(node, *unit_scale);
+            },
+            abstract.num);
+    };
+
+    // LEAF
+    return boost::apply_visitor(util::overloaded{
+        [&](ast::based_literal const& based) { return count_of(based); },
+        [&](ast::decimal_literal const& decimal) { return count_of(decimal); }
+    }, literal.literal);
+}
+
+}  // namespace convert
@@ -0,0 +1,171 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <literal/convert/spelling_cache.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace convert {
+
+namespace {
+
+static_assert(spelling_cache::MAX_KEY_SIZE <= UINT8_MAX);
+static_assert(std::has_single_bit(spelling_cache::CAPACITY), "capacity must be power of two");
+
+///
+/// Builds the normalized spelling and its FNV-1a hash in one pass.
+///
+class key_builder {
+public:
+    key_builder(char kind, unsigned base)
+    {
+        push(kind);
+        push(static_cast<char>(base));
+    }
+
+    void append(std::string_view digits)
+    {
+        for (char chr : digits) {
+            if (chr == '_') {
+                continue;
+            }
+            if ('A' <= chr && chr <= 'Z') {
+                chr = static_cast<char>(chr - 'A' + 'a');
+            }
+            push(chr);
+        }
+    }
+
+    /// The exponent of real and integer, where an explicit '+' is redundant.
+    void append_exponent(std::string_view exponent)
+    {
+        push('e');
+        if (!exponent.empty() && exponent.front() == '+') {
+            exponent.remove_prefix(1);
+        }
+        append(exponent);
+    }
+
+    std::optional<spelling_cache::key_type> get() const
+    {
+        if (overflow) {
+            return std::nullopt;
+        }
+        return key;
+    }
+
+private:
+    void push(char chr)
+    {
+        static std::uint64_t constexpr fnv_prime = 0x100000001b3ULL;
+
+        if (key.size == spelling_cache::MAX_KEY_SIZE) {
+            overflow = true;
+            return;
+        }
+        key.chars[key.size++] = chr;
+        key.hash = (key.hash ^ static_cast<unsigned char>(chr)) * fnv_prime;
+    }
+
+private:
+    spelling_cache::key_type key{ 0xcbf29ce484222325ULL, 0, {} };
+    bool overflow = false;
+};
+
+}  // namespace
+
+spelling_cache& spelling_cache::thread_instance()
+{
+    static thread_local spelling_cache cache;
+    return cache;
+}
+
+std::optional<spelling_cache::key_type> spelling_cache::make_key(ast::real_type const& real)
+{
+    key_builder builder{ 'r', real.base };
+    builder.append(real.integer);
+    builder.append(".");
+    builder.append(real.fractional);
+    builder.append_exponent(real.exponent);
+    return counted(builder.get());
+}
+
+std::optional<spelling_cache::key_type> spelling_cache::make_key(ast::integer_type const& int_)
+{
+    key_builder builder{ 'i', int_.base };
+    builder.append(int_.integer);
+    builder.append_exponent(int_.exponent);
+    return counted(builder.get());
+}
+
+std::optional<spelling_cache::key_type> spelling_cache::make_key(
+    ast::bit_string_literal const& literal)
+{
+    key_builder builder{ 'b', literal.base };
+    builder.append(literal.literal);
+    return counted(builder.get());
+}
+
+std::optional<spelling_cache::key_type> spelling_cache::counted(
+    std::optional<key_type> const& key)
+{
+    if (!key) {
+        ++the_stats.bypassed;
+    }
+    return key;
+}
+
+bool spelling_cache::equal(key_type const& lhs, key_type const& rhs)
+{
+    return lhs.hash == rhs.hash && lhs.size == rhs.size &&
+           std::equal(lhs.chars.begin(), lhs.chars.begin() + lhs.size, rhs.chars.begin());
+}
+
+std::optional<std::uint64_t> spelling_cache::find(key_type const& key)
+{
+    for (std::size_t probe = 0; probe != MAX_PROBES; ++probe) {
+        auto const& slot = table[(key.hash + probe) & (CAPACITY - 1)];
+        if (!slot.used) {
+            break;
+        }
+        if (equal(slot.key, key)) {
+            ++the_stats.hits;
+            return slot.value;
+        }
+    }
+
+    ++the_stats.misses;
+    return std::nullopt;
+}
+
+void spelling_cache::insert(key_type const& key, std::uint64_t value)
+{
+    auto const home = key.hash & (CAPACITY - 1);
+
+    for (std::size_t probe = 0; probe != MAX_PROBES; ++probe) {
+        auto& slot = table[(home + probe) & (CAPACITY - 1)];
+        if (!slot.used || equal(slot.key, key)) {
+            slot = entry{ key, value, true };
+            return;
+        }
+    }
+
+    // The probe window is full, evict one entry chosen by the upper hash bits. Since find()
+    // stops at the first unused slot, the window never gets holes by eviction.
+    auto const victim = (home + (key.hash >> 62)) & (CAPACITY - 1);
+    table[victim] = entry{ key, value, true };
+}
+
+void spelling_cache::clear()
+{
+    table.fill(entry{});
+    the_stats = statistics{};
+}
+
+}  // namespace convert
@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <literal/ast.hpp>
+#include <literal/convert/convert.hpp>
+#include <literal/convert/spelling_cache.hpp>
+#include <literal/convert/leaf_errors.hpp>
+
+#include <boost/leaf.hpp>
+
+#include <system_error>
+
+namespace ast {
+
+namespace leaf = boost::leaf;
+
+namespace {
+
+template <typename T, typename ConvertF>
+T memoized_convert(util::memoized_value<T> const& memo, ConvertF convert_fn)
+{
+    auto const* failure = memo.get_or_compute([&](T& value) {
+        return leaf::try_catch(
+            [&] {
+                // LEAF
+                value = convert_fn();
+                return util::memo_failure{};
+            },
+            [](std::error_code const& ec, leaf::e_api_function const* api_fcn) {
+                return util::memo_failure{ ec, api_fcn ? api_fcn->value : nullptr };
+            },
+            [](std::exception const&) {
+                return util::memo_failure{ std::make_error_code(std::errc::invalid_argument) };
+            });
+    });
+
+    if (failure) {
+        auto const* api_function = failure->api_function ? failure->api_function : "value_of";
+        throw leaf::exception(failure->ec, leaf::e_api_function{ api_function });
+    }
+
+    return *memo;
+}
+
+}  // namespace
+
+real_type::value_type value_of(real_type const& real)
+{
+    return memoized_convert(real.value, [&] {
+        return convert::cached(real, convert::real<real_type::value_type>);
+    });
+}
+
+integer_type::value_type value_of(integer_type const& int_)
+{
+    return memoized_convert(int_.value, [&] {
+        return convert::cached(int_, convert::integer<integer_type::value_type>);
+    });
+}
+
+bit_string_literal::value_type value_of(bit_string_literal const& literal)
+{
+    return memoized_convert(literal.value, [&] {
+        return convert::cached(literal,
+                               convert::bit_string_literal<bit_string_literal::value_type>);
+    });
+}
+
+}  // namespace ast
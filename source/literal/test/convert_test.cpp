@@ -0,0 +1,645 @@
+//
+// Copyright (c) 2017-2022 Olaf (<ibis-hdl@users.noreply.github.com>).
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <literal/ast.hpp>
+#include <literal/convert/convert.hpp>
+#include <literal/convert/convert_all.hpp>
+#include <literal/convert/literal_value.hpp>
+#include <literal/convert/physical_unit.hpp>
+#include <literal/convert/spelling_cache.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <cmath>
+#include <memory_resource>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace testsuite_data {
+
+ast::bit_string_literal bit_string(std::uint32_t base, std::string literal)
+{
+    ast::bit_string_literal result;
+    result.base = base;
+    result.literal = std::move(literal);
+    return result;
+}
+
+ast::real_type real(unsigned base, std::string integer, std::string fractional,
+                   std::string exponent = {})
+{
+    ast::real_type result;
+    result.base = base;
+    result.integer = std::move(integer);
+    result.fractional = std::move(fractional);
+    result.exponent = std::move(exponent);
+    return result;
+}
+
+ast::integer_type integer(unsigned base, std::string integer, std::string exponent = {})
+{
+    ast::integer_type result;
+    result.base = base;
+    result.integer = std::move(integer);
+    result.exponent = std::move(exponent);
+    return result;
+}
+
+template <typename NumT>
+ast::literal abstract_literal(NumT num)
+{
+    ast::based_literal literal;
+    literal.num = std::move(num);
+    return ast::literal{ ast::numeric_literal{ ast::abstract_literal{ std::move(literal) } } };
+}
+
+template <typename NumT>
+ast::literal physical_literal(NumT num, std::string unit_name)
+{
+    ast::based_literal based;
+    based.num = std::move(num);
+    ast::physical_literal literal;
+    literal.literal = std::move(based);
+    literal.unit_name = std::move(unit_name);
+    return ast::literal{ ast::numeric_literal{ std::move(literal) } };
+}
+
+struct decimal_real_reference {
+    std::string literal;
+    double value;
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define DECIMAL_REAL_REFERENCE(literal) decimal_real_reference{ #literal, literal }
+
+// Decimal reals, which are hard to round correctly. Reference is the compiler, which rounds
+// floating-point literals correctly.
+std::vector<decimal_real_reference> const hard_decimal_reals = {
+    DECIMAL_REAL_REFERENCE(0.1),
+    DECIMAL_REAL_REFERENCE(0.3),
+    DECIMAL_REAL_REFERENCE(2.2250738585072011e-308),
+    DECIMAL_REAL_REFERENCE(2.2250738585072012e-308),
+    DECIMAL_REAL_REFERENCE(4.9406564584124654e-324),
+    DECIMAL_REAL_REFERENCE(1.7976931348623157e308),
+    DECIMAL_REAL_REFERENCE(9007199254740993.0),
+    DECIMAL_REAL_REFERENCE(9007199254740992.9999999999999999999999999),
+    DECIMAL_REAL_REFERENCE(0.500000000000000166533453693773481063544750213623046875),
+    DECIMAL_REAL_REFERENCE(3.0517578125e-05),
+    DECIMAL_REAL_REFERENCE(1.00000000000000011102230246251565404236316680908203125),
+    DECIMAL_REAL_REFERENCE(7.2057594037927933e16),
+    DECIMAL_REAL_REFERENCE(123456789012345678901234567890.0e-20),
+    DECIMAL_REAL_REFERENCE(1.0e-320),
+    DECIMAL_REAL_REFERENCE(1.0e23),
+    DECIMAL_REAL_REFERENCE(8.589973e9),
+};
+
+#undef DECIMAL_REAL_REFERENCE
+
+///
+/// Split a C++ like decimal floating-point literal into the parts of the AST.
+///
+ast::real_type decimal_real(std::string const& literal)
+{
+    auto const dot = literal.find('.');
+    auto const exp = literal.find('e');
+    auto const end = (exp == std::string::npos) ? literal.size() : exp;
+    auto const exponent = (exp == std::string::npos) ? std::string{} : literal.substr(exp + 1);
+    return real(10, literal.substr(0, dot), literal.substr(dot + 1, end - dot - 1), exponent);
+}
+
+} // namespace testsuite_data
+
+BOOST_AUTO_TEST_SUITE(literal_convert)
+
+BOOST_AUTO_TEST_CASE(packed_bit_string_literal)
+{
+    using testsuite_data::bit_string;
+    using stream_type = boost::test_tools::output_test_stream;
+
+    auto const wide = convert::packed_bit_string_literal(
+        bit_string(16, "DEAD_BEEF_CAFE_AFFE_0123_4567_89ab_cdef"));
+    BOOST_TEST(wide.size() == 128U);
+    BOOST_TEST(wide.words.size() == 2U);
+    BOOST_TEST(wide.words[0] == 0x0123'4567'89AB'CDEFULL);
+    BOOST_TEST(wide.words[1] == 0xDEAD'BEEF'CAFE'AFFEULL);
+
+    // octal digits straddle the word boundary
+    auto const octal = convert::packed_bit_string_literal(
+        bit_string(8, "7_7_7_1234567012345670123456701"));
+    BOOST_TEST(octal.size() == 84U);
+    BOOST_TEST(octal.words[0] == 0x5DC1'4E5D'C14E'5DC1ULL);
+    BOOST_TEST(octal.words[1] == 0xF'F94EULL);
+
+    // leading zeros count for the bit length
+    auto const narrow = convert::packed_bit_string_literal(bit_string(16, "00F"));
+    BOOST_TEST(narrow.size() == 12U);
+    BOOST_TEST(narrow.words[0] == 0xFU);
+
+    auto const empty = convert::packed_bit_string_literal(bit_string(16, ""));
+    BOOST_TEST(empty.empty());
+    BOOST_TEST(empty.words.empty());
+    BOOST_TEST(convert::bit_string_literal<std::uint32_t>(bit_string(16, "")) == 0U);
+
+    auto os = stream_type{};
+    os << convert::packed_bit_string_literal(bit_string(2, "1000_0001"));
+    BOOST_TEST(os.is_equal(R"(8x"81")"));
+
+    BOOST_CHECK_THROW(convert::packed_bit_string_literal(bit_string(16, "0123456G")),
+                      std::exception);
+    BOOST_CHECK_THROW(convert::packed_bit_string_literal(bit_string(10, "42")),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(packed_bit_string_literal_arena)
+{
+    using testsuite_data::bit_string;
+
+    std::pmr::monotonic_buffer_resource arena;
+    auto const bits = convert::packed_bit_string_literal(
+        bit_string(16, std::string(1024, 'F')), convert::packed_bits::allocator_type{ &arena });
+
+    BOOST_TEST(bits.size() == 4096U);
+    BOOST_TEST(bits.words.get_allocator().resource() == &arena);
+    BOOST_TEST(std::ranges::all_of(bits.words, [](auto word) { return word == ~0ULL; }));
+}
+
+BOOST_AUTO_TEST_CASE(based_real_correctly_rounded)
+{
+    using testsuite_data::real;
+    using real_type = ast::real_type::value_type;
+
+    // the exact engine, used for decimal literals gives same result as reference
+    for (auto const& [literal, reference] : testsuite_data::hard_decimal_reals) {
+        auto const parts = testsuite_data::decimal_real(literal);
+        auto const value = convert::detail::based_real<real_type>(10, parts.integer,
+                                                                   parts.fractional,
+                                                                   parts.exponent);
+        BOOST_TEST_INFO("literal: " << literal);
+        BOOST_TEST(value == reference);
+    }
+
+    // a single, correctly rounded IEEE division is the reference here
+    BOOST_TEST(convert::real<real_type>(real(3, "0", "1")) == 1.0 / 3.0);
+    BOOST_TEST(convert::real<real_type>(real(7, "0", "1_1", "1")) == 8.0 / 7.0);
+    BOOST_TEST(convert::real<real_type>(real(36, "Z", "Z")) == 1295.0 / 36.0);
+    BOOST_TEST(convert::real<real_type>(real(3, "1", "0", "-1")) == 1.0 / 3.0);
+    BOOST_TEST(convert::real<real_type>(real(4, "1_20", "0", "1")) == 96.0);
+    // 5^24 - 1 exceeds the precision of double and must be rounded once
+    BOOST_TEST(convert::real<real_type>(real(5, "4444_4444_4444_4444_4444_4444", "0")) ==
+               59604644775390624.0);
+
+    BOOST_CHECK_THROW(convert::real<real_type>(real(3, "1", "0", "700")), std::exception);
+    BOOST_CHECK_THROW(convert::real<real_type>(real(3, "1", "0", "-700")), std::exception);
+    BOOST_CHECK_THROW(convert::real<real_type>(real(3, "1", "3")), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(pow2_based_real_exact)
+{
+    using testsuite_data::real;
+    using real_type = ast::real_type::value_type;
+
+    // 1.11111111111b * 2^11
+    BOOST_TEST(convert::real<real_type>(real(2, "1", "1111_1111_111", "11")) == 4095.0);
+    // 15.99609375 * 16^2
+    BOOST_TEST(convert::real<real_type>(real(16, "F", "FF", "+2")) == 4095.0);
+    BOOST_TEST(convert::real<real_type>(real(16, "0", "8", "-200")) == std::ldexp(0.5, -800));
+    BOOST_TEST(convert::real<real_type>(real(8, "0_7", "4")) == 7.5);
+    BOOST_TEST(convert::real<real_type>(real(4, "3", "2")) == 3.5);
+    BOOST_TEST(convert::real<real_type>(real(32, "V", "G", "1")) == 1008.0);
+    BOOST_TEST(convert::real<real_type>(real(16, "000", "000")) == 0.0);
+
+    // more digits than the mantissa holds: 2^53 + 1 is a tie, rounded to even; any
+    // non-zero digit beyond breaks the tie
+    BOOST_TEST(convert::real<real_type>(real(16, "20_0000_0000_0001", "0")) == 0x1p53);
+    BOOST_TEST(convert::real<real_type>(real(16, "20_0000_0000_0001", "0000_0000_0000_0000_01")) ==
+               0x1.0000000000001p53);
+    // smallest subnormal and overflow
+    BOOST_TEST(convert::real<real_type>(real(2, "1", "0", "-1074")) == 0x1p-1074);
+    BOOST_CHECK_THROW(convert::real<real_type>(real(2, "1", "0", "-1076")), std::exception);
+    BOOST_CHECK_THROW(convert::real<real_type>(real(16, "1", "0", "256")), std::exception);
+    BOOST_CHECK_THROW(convert::real<real_type>(real(8, "8", "0")), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(binary_mantissa_to_real)
+{
+    auto const to_real = [](std::uint64_t value, std::int64_t exponent, bool sticky = false) {
+        return convert::detail::to_real<double>({ value, exponent, sticky }, "to_real");
+    };
+
+    // exact mantissas with few significant bits
+    BOOST_TEST(to_real(3, 0) == 3.0);
+    BOOST_TEST(to_real(1, 3) == 8.0);
+    BOOST_TEST(to_real(5, -1) == 2.5);
+    BOOST_TEST(to_real(1, -1070) == 0x1p-1070);
+    BOOST_TEST(to_real(1, -1074) == 0x1p-1074);
+    BOOST_TEST(to_real(0x1F'FFFF'FFFF'FFFF, 0) == 0x1.FFFFFFFFFFFFFp52);
+
+    // normalized mantissas are rounded to nearest, ties to even
+    BOOST_TEST(to_real(0x8000'0000'0000'0400, -63) == 1.0);
+    BOOST_TEST(to_real(0x8000'0000'0000'0400, -63, true) == 0x1.0000000000001p0);
+    BOOST_TEST(to_real(0x8000'0000'0000'0C00, -63) == 0x1.0000000000002p0);
+
+    BOOST_CHECK_THROW(to_real(1, -1076), std::exception);
+    BOOST_CHECK_THROW(to_real(1, 1024), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(power_tables)
+{
+    using convert::detail::power;
+
+    // all bases have exact tables up to the largest representable power
+    BOOST_TEST(power<std::uint32_t>(10, 9) == 1'000'000'000U);
+    BOOST_CHECK_THROW(power<std::uint32_t>(10, 10), std::exception);
+    BOOST_TEST(power<std::uint64_t>(3, 40) == 12'157'665'459'056'928'801ULL);
+    BOOST_CHECK_THROW(power<std::uint64_t>(3, 41), std::exception);
+    BOOST_TEST(power<std::uint64_t>(36, 12) == 4'738'381'338'321'616'896ULL);
+    BOOST_TEST(power<std::uint8_t>(7, 2) == 49U);
+    BOOST_CHECK_THROW(power<std::uint8_t>(7, 3), std::exception);
+
+    // exact table entries, beyond correctly rounded
+    BOOST_TEST(power<double>(10, 22) == 1e22);
+    BOOST_TEST(power<double>(10, 23) == 1e23);
+    BOOST_TEST(power<double>(10, -300) == 1e-300);
+    BOOST_TEST(power<double>(3, -5) == 1.0 / 243.0);
+    // correctly rounded 36^100, computed exactly by multi-precision arithmetic
+    BOOST_TEST(power<double>(36, 100) == 0x1.fd5863c3eb047p+516);
+    BOOST_TEST(power<double>(2, -1074) == 0x1p-1074);
+    BOOST_TEST(power<double>(2, 3) == 8.0);
+    BOOST_TEST(power<double>(16, 2) == 256.0);
+    BOOST_TEST(power<double>(16, -2) == 0x1p-8);
+    BOOST_TEST(power<double>(8, 100) == 0x1p300);
+    BOOST_TEST(power<double>(32, 0) == 1.0);
+    BOOST_TEST(power<float>(10, 10) == 1e10F);
+    BOOST_CHECK_THROW(power<double>(7, 400), std::exception);
+    BOOST_CHECK_THROW(power<double>(16, -300), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(safe_math_checked)
+{
+    auto constexpr uint32_max = std::numeric_limits<std::uint32_t>::max();
+    auto constexpr double_max = std::numeric_limits<double>::max();
+
+    BOOST_TEST(util::mul<std::uint32_t>(65535U, 65537U) == uint32_max);
+    BOOST_CHECK_THROW(util::mul<std::uint32_t>(65536U, 65536U), std::exception);
+    BOOST_TEST(util::add<std::uint64_t>(1U, 2U) == 3U);
+    BOOST_CHECK_THROW(util::add<std::uint32_t>(uint32_max, 1U), std::exception);
+
+    BOOST_TEST(util::mul<double>(1.5, 2.0) == 3.0);
+    BOOST_TEST(util::mul<double>(0.0, double_max) == 0.0);
+    // exact subnormal results don't underflow
+    BOOST_TEST(util::mul<double>(0x1p-1000, 0x1p-70) == 0x1p-1070);
+    BOOST_CHECK_THROW(util::mul<double>(0x1.8p-1000, 0x1p-74), std::exception);
+    BOOST_CHECK_THROW(util::mul<double>(0x1p-1000, 0x1p-100), std::exception);
+    // nonzero operands, whose product rounds to zero
+    BOOST_CHECK_THROW(util::mul<double>(1e-200, 1e-200), std::exception);
+    BOOST_CHECK_THROW(util::mul<double>(-1e-200, 1e-200), std::exception);
+    BOOST_CHECK_THROW(util::mul<double>(double_max, 2.0), std::exception);
+    BOOST_TEST(util::add<double>(0x1p-1074, 0x1p-1074) == 0x1p-1073);
+    BOOST_CHECK_THROW(util::add<double>(double_max, double_max), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(decimal_real_native)
+{
+    using testsuite_data::real;
+    using real_type = ast::real_type::value_type;
+
+    for (auto const& [literal, reference] : testsuite_data::hard_decimal_reals) {
+        BOOST_TEST_INFO("literal: " << literal);
+        BOOST_TEST(convert::real<real_type>(testsuite_data::decimal_real(literal)) == reference);
+    }
+
+    // fast path
+    BOOST_TEST(convert::real<real_type>(real(10, "1", "5", "2")) == 150.0);
+    BOOST_TEST(convert::real<real_type>(real(10, "3", "14", "+1")) == 31.4);
+    BOOST_TEST(convert::real<real_type>(real(10, "2", "2", "-6")) == 2.2e-6);
+    BOOST_TEST(convert::real<real_type>(real(10, "0", "000_1")) == 1e-4);
+    BOOST_TEST(convert::real<real_type>(real(10, "000", "0", "999")) == 0.0);
+    BOOST_TEST(convert::real<float>(real(10, "0", "1")) == 0.1F);
+    BOOST_TEST(convert::real<float>(real(10, "16777217", "0")) == 16777216.0F);
+
+    BOOST_CHECK_THROW(convert::real<real_type>(real(10, "1", "0", "309")), std::exception);
+    BOOST_CHECK_THROW(convert::real<real_type>(real(10, "1", "0", "-325")), std::exception);
+    BOOST_CHECK_THROW(convert::real<real_type>(real(10, "1", "A")), std::exception);
+
+#if defined(__cpp_lib_to_chars)
+    // differential test against `std::from_chars()`, which is correctly rounded
+    std::mt19937_64 random_engine{ 42 };  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    auto const random_digits = [&](std::size_t count) {
+        std::string digits(count, '0');
+        for (auto& digit : digits) {
+            digit = static_cast<char>('0' + random_engine() % 10);
+        }
+        return digits;
+    };
+
+    for (unsigned i = 0; i != 10'000; ++i) {
+        auto const integer = random_digits(1 + random_engine() % 20);
+        auto const fractional = random_digits(1 + random_engine() % 20);
+        auto const exponent = std::to_string(static_cast<int>(random_engine() % 700) - 350);
+        auto const literal = integer + "." + fractional + "e" + exponent;
+
+        real_type reference{};
+        auto const [ptr, ec] =
+            std::from_chars(literal.data(), literal.data() + literal.size(), reference);
+
+        // libstdc++ reports subnormal results as out of range too, they are valid here
+        auto const subnormal = [&] {
+            if (ec != std::errc::result_out_of_range) {
+                return false;
+            }
+            reference = std::strtod(literal.c_str(), nullptr);
+            return std::fpclassify(reference) == FP_SUBNORMAL;
+        };
+
+        BOOST_TEST_INFO("literal: " << literal);
+        if (ec == std::errc{} || subnormal()) {
+            BOOST_TEST(convert::real<real_type>(real(10, integer, fractional, exponent)) ==
+                       reference);
+        }
+        else {
+            BOOST_CHECK_THROW(convert::real<real_type>(real(10, integer, fractional, exponent)),
+                              std::exception);
+        }
+    }
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(literal_value_constant_evaluation)
+{
+    using convert::literal_value;
+
+    // integer literals
+    static_assert(literal_value<std::uint32_t>("42") == 42);
+    static_assert(literal_value<std::uint32_t>("1_000") == 1000);
+    static_assert(literal_value<std::uint32_t>("1E6") == 1'000'000);
+    static_assert(literal_value<std::uint32_t>("16#AFFE#") == 0xAFFE);
+    static_assert(literal_value<std::uint32_t>("16#affe#") == 0xAFFE);
+    static_assert(literal_value<std::uint32_t>("16:AF_FE:") == 0xAFFE);
+    static_assert(literal_value<std::uint32_t>("2#1010#E2") == 40);
+    static_assert(literal_value<std::uint32_t>("36#ZZ#") == 36 * 36 - 1);
+    static_assert(literal_value<std::uint64_t>("16#FFFF_FFFF_FFFF_FFFF#") == UINT64_MAX);
+
+    // bit string literals
+    static_assert(literal_value<std::uint32_t>("X\"AFFE\"") == 0xAFFE);
+    static_assert(literal_value<std::uint32_t>("O\"17\"") == 15);
+    static_assert(literal_value<std::uint32_t>("b\"1010_1010\"") == 0xAA);
+
+    // decimal real literals
+    static_assert(literal_value<double>("1.5") == 1.5);
+    static_assert(literal_value<double>("1.5E-3") == 1.5e-3);
+    static_assert(literal_value<double>("3.141_592_653_589_793") == 3.141592653589793);
+    static_assert(literal_value<double>("0.000_1e+10") == 1e6);
+    static_assert(literal_value<float>("0.1") == 0.1F);
+
+    // same result as by run time conversion
+    auto const runtime_value = [](std::string_view spelling) {
+        return convert::detail::literal_value_of<std::uint32_t>(spelling);
+    };
+    BOOST_TEST(runtime_value("16#AF_FE#") == literal_value<std::uint32_t>("16#AF_FE#"));
+    BOOST_TEST(runtime_value("2#1010#E+2") == literal_value<std::uint32_t>("2#1010#E+2"));
+    BOOST_CHECK_THROW(runtime_value("16#AFFE"), std::exception);
+    BOOST_CHECK_THROW(runtime_value("1.5"), std::exception);
+    BOOST_CHECK_THROW(runtime_value("16#AFFE_CAFEE#"), std::exception);
+    BOOST_CHECK_THROW(runtime_value("1E-2"), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(physical_literal_normalized)
+{
+    using namespace testsuite_data;
+
+    static_assert(convert::unit_table::time_unit_scale("NS") == 1'000'000);
+    static_assert(!convert::unit_table::time_unit_scale("kg"));
+
+    auto const count = [](ast::literal const& literal, convert::unit_table const& units = {}) {
+        auto const& physical =
+            boost::get<ast::physical_literal>(boost::get<ast::numeric_literal>(literal));
+        return convert::physical_literal(physical, units);
+    };
+
+    BOOST_TEST(count(physical_literal(integer(10, "1"), "fs")) == 1);
+    BOOST_TEST(count(physical_literal(integer(10, "42"), "ns")) == 42'000'000);
+    BOOST_TEST(count(physical_literal(integer(16, "FF"), "PS")) == 255'000);
+    BOOST_TEST(count(physical_literal(integer(10, "2"), "hr")) == 7'200'000'000'000'000'000);
+    BOOST_TEST(count(physical_literal(real(10, "1", "5"), "ns")) == 1'500'000);
+    BOOST_TEST(count(physical_literal(real(10, "0", "1"), "ns")) == 100'000);
+    BOOST_TEST(count(physical_literal(real(10, "2", "5", "-6"), "ns")) == 2);  // tie to even
+    BOOST_TEST(count(physical_literal(real(10, "3", "5", "-6"), "ns")) == 4);  // tie to even
+    BOOST_TEST(count(physical_literal(real(10, "1", "0", "-100"), "hr")) == 0);
+    BOOST_TEST(count(physical_literal(real(2, "1", "1"), "ps")) == 1'500);
+    BOOST_TEST(count(physical_literal(real(3, "0", "1"), "sec")) == 333'333'333'333'333);
+    // standalone unit name
+    BOOST_TEST(count(physical_literal(ast::real_type{}, "us")) == 1'000'000'000);
+
+    // overflow: 2^63 fs are approx. 2.56 hr
+    BOOST_TEST(count(physical_literal(integer(10, "9_223"), "sec")) == 9'223'000'000'000'000'000);
+    BOOST_CHECK_THROW(count(physical_literal(integer(10, "9_224"), "sec")), std::exception);
+    BOOST_CHECK_THROW(count(physical_literal(integer(10, "3"), "hr")), std::exception);
+    BOOST_CHECK_THROW(count(physical_literal(real(10, "2", "6"), "hr")), std::exception);
+    BOOST_CHECK_THROW(count(physical_literal(real(16, "2", "A"), "hr")), std::exception);
+    BOOST_CHECK_THROW(count(physical_literal(real(10, "1", "0", "100"), "fs")), std::exception);
+
+    // unknown unit
+    BOOST_CHECK_THROW(count(physical_literal(integer(10, "1"), "kg")), std::exception);
+
+    // user registered units
+    convert::unit_table units;
+    units.add("kfs", 1000, "fs");
+    units.add("dsec", 10, "SEC");
+    BOOST_TEST(count(physical_literal(integer(10, "7"), "KFS"), units) == 7'000);
+    BOOST_TEST(count(physical_literal(real(10, "0", "5"), "dsec"), units) == 5'000'000'000'000'000);
+    BOOST_CHECK_THROW(units.add("ns", 1, "fs"), std::exception);
+    BOOST_CHECK_THROW(units.add("foo", 1, "bar"), std::exception);
+    BOOST_CHECK_THROW(units.add("day", 24, "hr"), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(convert_all_literals)
+{
+    using namespace testsuite_data;
+
+    auto const value_of = [](ast::literal const& literal) {
+        auto const& numeric = boost::get<ast::numeric_literal>(literal);
+        auto const& based = boost::get<ast::based_literal>(
+            boost::get<ast::abstract_literal>(numeric));
+        return based.num;
+    };
+
+    ast::literals literals = {
+        abstract_literal(integer(10, "42")),
+        ast::literal{ ast::string_literal{} },
+        abstract_literal(real(16, "F", "FF", "+2")),
+        ast::literal{ bit_string(16, "AFFE") },
+        ast::literal{ bit_string(16, "AFFE_Cafee") },  // out of range
+        physical_literal(integer(10, "42", "4"), "ns"),
+        abstract_literal(integer(2, "1111_1111")),
+        physical_literal(ast::real_type{}, "us"),  // unit alone
+    };
+
+    auto const failures = convert::convert_all(literals);
+
+    BOOST_REQUIRE(failures.size() == 1U);
+    BOOST_TEST(failures[0].index == 4U);
+    BOOST_TEST(failures[0].ec == std::make_error_code(std::errc::result_out_of_range));
+
+    BOOST_TEST(boost::get<ast::integer_type>(value_of(literals[0])).value.value_or(0) == 42U);
+    BOOST_TEST(boost::get<ast::real_type>(value_of(literals[2])).value.value_or(0) == 4095.0);
+    BOOST_TEST(boost::get<ast::bit_string_literal>(literals[3]).value.value_or(0) == 0xAFFEU);
+    BOOST_TEST(!boost::get<ast::bit_string_literal>(literals[4]).value.has_value());
+    BOOST_TEST(boost::get<ast::integer_type>(value_of(literals[6])).value.value_or(0) == 255U);
+
+    auto const& physical =
+        boost::get<ast::physical_literal>(boost::get<ast::numeric_literal>(literals[5]));
+    auto const& based = boost::get<ast::based_literal>(physical.literal);
+    BOOST_TEST(boost::get<ast::integer_type>(based.num).value.value_or(0) == 420'000U);
+    BOOST_TEST(physical.value.value_or(0) == 420'000'000'000);
+
+    auto const& unit =
+        boost::get<ast::physical_literal>(boost::get<ast::numeric_literal>(literals[7]));
+    BOOST_TEST(!boost::get<ast::real_type>(boost::get<ast::based_literal>(unit.literal).num)
+                    .value.has_value());
+    BOOST_TEST(unit.value.value_or(0) == 1'000'000'000);
+    // the real of a unit alone has no base, there is no value
+    BOOST_CHECK_THROW(convert::real<double>(ast::real_type{}), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(convert_all_literals_parallel)
+{
+    using namespace testsuite_data;
+
+    ast::literals literals;
+    for (unsigned i = 0; i != 50'000; ++i) {
+        switch (i % 3) {
+            case 0:
+                literals.push_back(abstract_literal(integer(10, std::to_string(i))));
+                break;
+            case 1:
+                literals.push_back(abstract_literal(real(8, fmt::format("{:o}", i), "4")));
+                break;
+            default:
+                literals.push_back(ast::literal{ bit_string(2, (i % 1000 == 2) ? "12" : "1010") });
+        }
+    }
+
+    auto sequential_literals = literals;
+    auto const sequential = convert::convert_all(sequential_literals);
+    auto const parallel = convert::convert_all(literals, convert::convert_mode::parallel);
+
+    BOOST_TEST(sequential.size() == 17U);
+    BOOST_REQUIRE(parallel.size() == sequential.size());
+    for (std::size_t i = 0; i != parallel.size(); ++i) {
+        BOOST_TEST(parallel[i].index == sequential[i].index);
+    }
+    BOOST_TEST(std::ranges::is_sorted(parallel, {}, &convert::conversion_failure::index));
+
+    std::ostringstream sequential_os;
+    std::ostringstream parallel_os;
+    for (std::size_t i = 0; i != literals.size(); ++i) {
+        sequential_os << sequential_literals[i] << '\n';
+        parallel_os << literals[i] << '\n';
+    }
+    BOOST_TEST(parallel_os.str() == sequential_os.str());
+}
+
+BOOST_AUTO_TEST_CASE(value_of_memoized)
+{
+    using namespace testsuite_data;
+
+    auto const real_literal = real(16, "F", "FF", "+2");
+    BOOST_TEST(!real_literal.value.has_value());
+    BOOST_TEST(ast::value_of(real_literal) == 4095.0);
+    BOOST_TEST(real_literal.value.has_value());
+    BOOST_TEST(ast::value_of(real_literal) == 4095.0);
+
+    // a copy takes the cached value
+    auto const real_copy = real_literal;
+    BOOST_TEST(real_copy.value.value_or(0) == 4095.0);
+
+    // an assigned value, e.g. by the parser, isn't converted again
+    auto int_literal = integer(10, "42");
+    int_literal.value = 43U;
+    BOOST_TEST(ast::value_of(int_literal) == 43U);
+
+    // the failure is cached too
+    auto const bit_literal = bit_string(16, "AFFE_Cafee");
+    BOOST_CHECK_THROW(ast::value_of(bit_literal), std::exception);
+    BOOST_TEST(!bit_literal.value.has_value());
+    BOOST_CHECK_THROW(ast::value_of(bit_literal), std::exception);
+
+    // concurrent readers
+    auto const shared_literal = integer(2, "1111_1111", "2");
+    std::vector<ast::integer_type::value_type> results(8);
+    {
+        std::vector<std::jthread> readers;
+        for (auto& result : results) {
+            readers.emplace_back([&] { result = ast::value_of(shared_literal); });
+        }
+    }
+    BOOST_TEST(std::ranges::all_of(results, [](auto value) { return value == 1020U; }));
+}
+
+BOOST_AUTO_TEST_CASE(spelling_cache_hits)
+{
+    using namespace testsuite_data;
+
+    convert::spelling_cache::enable(true);
+    auto& cache = convert::spelling_cache::thread_instance();
+    cache.clear();
+
+    // same value by different spelling: delimiter, letter case and explicit exponent sign
+    BOOST_TEST(ast::value_of(integer(16, "FF")) == 255U);
+    BOOST_TEST(ast::value_of(integer(16, "f_f")) == 255U);
+    BOOST_TEST(ast::value_of(real(10, "1", "5", "+2")) == 150.0);
+    BOOST_TEST(ast::value_of(real(10, "1", "5", "2")) == 150.0);
+    BOOST_TEST(ast::value_of(bit_string(16, "AFFE")) == 0xAFFEU);
+    BOOST_TEST(ast::value_of(bit_string(16, "af_fe")) == 0xAFFEU);
+    // same digits, different kind or base
+    BOOST_TEST(ast::value_of(integer(16, "17")) == 23U);
+    BOOST_TEST(ast::value_of(integer(8, "17")) == 15U);
+    BOOST_TEST(ast::value_of(bit_string(8, "17")) == 15U);
+    BOOST_TEST(cache.stats().hits == 3U);
+    cache.clear();
+
+    // the "corpus": few distinct spellings, which repeat
+    for (unsigned i = 0; i != 100; ++i) {
+        BOOST_TEST(ast::value_of(integer(10, std::to_string(i % 10))) == i % 10);
+    }
+    BOOST_TEST(cache.stats().misses == 10U);
+    BOOST_TEST(cache.stats().hits == 90U);
+    BOOST_TEST(cache.stats().hit_rate() == 0.9);
+
+    // failures aren't cached
+    BOOST_CHECK_THROW(ast::value_of(bit_string(16, "AFFE_Cafee")), std::exception);
+    BOOST_CHECK_THROW(ast::value_of(bit_string(16, "AFFE_Cafee")), std::exception);
+    BOOST_TEST(cache.stats().hits == 90U);
+
+    // too long to be cached
+    auto const long_digits = std::string(64, '1');
+    BOOST_TEST(ast::value_of(real(10, "0", long_digits, "")) == 0.1111111111111111);
+    BOOST_TEST(cache.stats().bypassed == 1U);
+
+    // more distinct spellings than capacity: bounded, still correct
+    for (unsigned i = 0; i != 4 * convert::spelling_cache::CAPACITY; ++i) {
+        BOOST_TEST_REQUIRE(ast::value_of(integer(10, std::to_string(i))) == i);
+    }
+    for (unsigned i = 0; i != 4 * convert::spelling_cache::CAPACITY; ++i) {
+        BOOST_TEST_REQUIRE(ast::value_of(integer(10, std::to_string(i))) == i);
+    }
+
+    cache.clear();
+    convert::spelling_cache::enable(false);
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+BOOST_AUTO_TEST_SUITE_END()
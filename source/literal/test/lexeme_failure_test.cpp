@@ -10,6 +10,7 @@
 #include <boost/test/tools/output_test_stream.hpp>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace testsuite_data {
@@ -60,5 +61,88 @@ BOOST_AUTO_TEST_CASE(basic_parser_lexeme_failure)
     }
 }
 
+BOOST_AUTO_TEST_CASE(fast_scan_lexeme_failure)
+{
+    using stream_type = boost::test_tools::output_test_stream;
+
+    // the diagnostics of the fast path are those of the X3 grammar
+    for (auto const& input : testsuite_data::lexeme_failure) {
+        reset_error_counter();
+        auto os_x3 = stream_type{};
+        ast::literals literals_x3;
+        bool const parse_ok_x3 = parse(input, literals_x3, os_x3, parse_mode::x3);
+
+        reset_error_counter();
+        auto os_fast = stream_type{};
+        ast::literals literals_fast;
+        bool const parse_ok_fast = parse(input, literals_fast, os_fast, parse_mode::fast_scan);
+
+        BOOST_TEST(parse_ok_fast == parse_ok_x3);
+        BOOST_TEST(os_fast.str() == os_x3.str());
+        BOOST_TEST(literals_fast.size() == literals_x3.size());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parse_limits_lexeme_failure)
+{
+    using stream_type = boost::test_tools::output_test_stream;
+
+    parser::parse_limits limits;
+    limits.max_value_bits = 16;  // i.e. 5 decimal, 4 hexadecimal digits
+    limits.max_identifier_length = 8;
+    limits.max_string_length = 8;
+    limits.max_statement_length = 32;
+
+    // clang-format off
+    std::vector<std::pair<std::string, bool>> const inputs = {
+        // input, exceeds limit
+        { "X := 12345;",            false },
+        { "X := 123456;",           true },
+        { "X := 1_2_3_4_5;",        false },  // delimiters aren't counted
+        { "X := 1_2_3_4_5_6;",      true },
+        { "X := 1.234567;",         true },
+        { "X := 16#FFFF#;",         false },
+        { "X := 16#FFFF_F#;",       true },
+        { R"(X := x"FFFF";)",       false },
+        { R"(X := x"FFFFF";)",      true },
+        { "X := abcdefgh;",         false },
+        { "X := abcdefghi;",        true },
+        { "X := 42 abcdefghi;",     true },
+        { R"(X := "12345678";)",    false },
+        { R"(X := "123456789";)",   true },
+        { R"(X := "1234""5678";)",  true },
+        { R"(X := "1234" /* longer comment */;)", true }
+    };
+    // clang-format on
+
+    for (auto const& [input, exceeds_limit] : inputs) {
+        BOOST_TEST_CONTEXT("input '" << input << "'") {
+            reset_error_counter();
+            auto os_x3 = stream_type{};
+            ast::literals literals_x3;
+            bool const parse_ok_x3 = parse(input, literals_x3, os_x3, parse_mode::x3, limits);
+
+            reset_error_counter();
+            auto os_fast = stream_type{};
+            ast::literals literals_fast;
+            bool const parse_ok_fast =
+                parse(input, literals_fast, os_fast, parse_mode::fast_scan, limits);
+
+            BOOST_TEST(parse_ok_x3);
+            BOOST_TEST(parse_ok_fast == parse_ok_x3);
+            BOOST_TEST(os_fast.str() == os_x3.str());
+            BOOST_TEST((os_x3.str().find("of at most") != std::string::npos) == exceeds_limit);
+            BOOST_TEST(literals_x3.size() == (exceeds_limit ? 0U : 1U));
+        }
+    }
+
+    // the default limits of the session
+    reset_error_counter();
+    auto os = stream_type{};
+    ast::literals literals;
+    BOOST_TEST(parse("X := 123456; X := abcdefghi;", literals, os));
+    BOOST_TEST(literals.size() == 2U);
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 BOOST_AUTO_TEST_SUITE_END()